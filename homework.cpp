@@ -1,4 +1,5 @@
 #include <iostream>
+#include <iomanip>
 #include <vector>
 #include <thread>
 #include <chrono>
@@ -6,6 +7,39 @@
 #include <mutex>
 #include <cmath> 
 #include <algorithm> 
+#include <string>
+#include <map>
+#include <random>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <coroutine>
+#include <condition_variable>
+#include <barrier>
+#include <sched.h>
+#include <sys/sysinfo.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#include <cstddef>
+#include <cstdio>
+#include <linux/futex.h>
+#include <pthread.h>
+#include <sys/resource.h>
+#include <ucontext.h>
+#include <linux/perf_event.h>
+#include <fcntl.h>
+#include <cstring>
+#include <cerrno>
+#if defined(__x86_64__) && __has_include(<sys/rseq.h>)
+#include <sys/rseq.h>
+#define HAVE_RSEQ 1
+#endif
+#if defined(__x86_64__)
+#include <x86intrin.h>
+#include <cpuid.h>
+#define HAVE_TSC 1
+#endif
 
 using namespace std;
 
@@ -17,6 +51,186 @@ constexpr int NUM_OPERATIONS = END_NUM - START_NUM + 1; // 총 연산 횟수
 
 long long shared_counter = 0; 
 
+const vector<int> thread_counts = {2, 4, 8, 16, 32};
+
+// 커맨드라인 옵션 (--key=value 형식)
+map<string, string> g_options;
+
+/**
+ * @brief 커맨드라인 인자 파싱
+ * @return 실행 모드 (첫 번째 비옵션 인자, 기본값 "counter")
+ */
+string parse_options(int argc, char* argv[]) {
+    string mode = "counter";
+    for (int i = 1; i < argc; ++i) {
+        string arg = argv[i];
+        if (arg.rfind("--", 0) == 0) {
+            size_t eq = arg.find('=');
+            if (eq == string::npos) {
+                g_options.insert_or_assign(arg.substr(2), string("1"));
+            } else {
+                g_options.insert_or_assign(arg.substr(2, eq - 2), arg.substr(eq + 1));
+            }
+        } else {
+            mode = arg;
+        }
+    }
+    return mode;
+}
+
+/**
+ * @brief 정수 옵션 값 조회 (없으면 기본값)
+ */
+long long option_value(const string& key, long long default_value) {
+    auto it = g_options.find(key);
+    return it == g_options.end() ? default_value : stoll(it->second);
+}
+
+/**
+ * @brief 타이머 보정 값
+ * 불변 TSC(CPUID 0x80000007 EDX bit 8)가 있으면 TSC를 CLOCK_MONOTONIC에 맞춰 보정해 쓰고,
+ * 없거나 --timer=monotonic 이면 clock_gettime(CLOCK_MONOTONIC)으로 대체한다 (이때 tick = 1 ns).
+ */
+struct Timer_Calibration {
+    bool use_tsc = false;
+    double ns_per_tick = 1.0;
+    uint64_t overhead_ticks = 0; // 시작/끝 읽기 한 쌍의 최소 비용 (측정 구간에서 뺀다)
+};
+
+inline uint64_t monotonic_now_ns() {
+    timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return uint64_t(ts.tv_sec) * 1'000'000'000ull + ts.tv_nsec;
+}
+
+bool has_invariant_tsc() {
+#if HAVE_TSC
+    unsigned eax, ebx, ecx, edx;
+    return __get_cpuid(0x80000007, &eax, &ebx, &ecx, &edx) && (edx & (1u << 8));
+#else
+    return false;
+#endif
+}
+
+const Timer_Calibration& timer_calibration();
+
+/**
+ * @brief 구간 시작 시각 (tick). lfence로 앞선 명령이 끝난 뒤, 뒤따르는 명령보다 먼저 읽는다.
+ */
+inline uint64_t timer_now() {
+#if HAVE_TSC
+    if (timer_calibration().use_tsc) {
+        _mm_lfence();
+        uint64_t ticks = __rdtsc();
+        _mm_lfence();
+        return ticks;
+    }
+#endif
+    return monotonic_now_ns();
+}
+
+/**
+ * @brief 구간 끝 시각 (tick). rdtscp는 앞선 명령이 모두 끝난 뒤 읽고, 뒤의 lfence가 이후 명령을 막는다.
+ */
+inline uint64_t timer_now_end() {
+#if HAVE_TSC
+    if (timer_calibration().use_tsc) {
+        unsigned aux;
+        uint64_t ticks = __rdtscp(&aux);
+        _mm_lfence();
+        return ticks;
+    }
+#endif
+    return monotonic_now_ns();
+}
+
+Timer_Calibration calibrate_timer() {
+    Timer_Calibration calibration;
+    auto it = g_options.find("timer");
+    calibration.use_tsc = has_invariant_tsc() && (it == g_options.end() || it->second != "monotonic");
+
+#if HAVE_TSC
+    if (calibration.use_tsc) {
+        constexpr uint64_t CALIBRATION_NS = 20'000'000;
+        uint64_t start_ns = monotonic_now_ns();
+        uint64_t start_ticks = __rdtsc();
+        uint64_t end_ns;
+        while ((end_ns = monotonic_now_ns()) - start_ns < CALIBRATION_NS);
+        uint64_t end_ticks = __rdtsc();
+        calibration.ns_per_tick = double(end_ns - start_ns) / double(end_ticks - start_ticks);
+    }
+#endif
+
+    // 보정 값이 정해지기 전이므로 timer_now()가 아니라 직접 읽는다
+    constexpr int OVERHEAD_SAMPLES = 1000;
+    uint64_t overhead = UINT64_MAX;
+    for (int i = 0; i < OVERHEAD_SAMPLES; ++i) {
+        uint64_t begin, end;
+#if HAVE_TSC
+        if (calibration.use_tsc) {
+            unsigned aux;
+            _mm_lfence();
+            begin = __rdtsc();
+            _mm_lfence();
+            end = __rdtscp(&aux);
+            _mm_lfence();
+        } else
+#endif
+        {
+            begin = monotonic_now_ns();
+            end = monotonic_now_ns();
+        }
+        overhead = min(overhead, end - begin);
+    }
+    calibration.overhead_ticks = overhead;
+    return calibration;
+}
+
+const Timer_Calibration& timer_calibration() {
+    static const Timer_Calibration calibration = calibrate_timer();
+    return calibration;
+}
+
+/**
+ * @brief 두 시각 사이의 경과 시간 (ns, 읽기 비용을 뺀 값)
+ * end가 start보다 앞서면 (다른 코어에서 찍은 시각의 어긋남 등) 0을 돌려준다.
+ */
+inline long long timer_elapsed_ns(uint64_t start, uint64_t end) {
+    const Timer_Calibration& calibration = timer_calibration();
+    if (end <= start) {
+        return 0;
+    }
+    uint64_t ticks = end - start;
+    ticks = ticks > calibration.overhead_ticks ? ticks - calibration.overhead_ticks : 0;
+    return (long long)(ticks * calibration.ns_per_tick);
+}
+
+/**
+ * @brief 두 시각 사이의 경과 시간 (초 단위 duration)
+ */
+inline chrono::duration<double> timer_elapsed(uint64_t start, uint64_t end) {
+    return chrono::duration<double>(timer_elapsed_ns(start, end) * 1e-9);
+}
+
+/**
+ * @brief ns를 tick 수로 변환 (tick 단위로 비교할 임계값 계산용)
+ */
+inline uint64_t timer_ticks_from_ns(long long ns) {
+    return uint64_t(ns / timer_calibration().ns_per_tick);
+}
+
+/**
+ * @brief 사용 중인 타이머 정보 출력
+ */
+void print_timer_info() {
+    const Timer_Calibration& calibration = timer_calibration();
+    if (calibration.use_tsc) {
+        cout << "Timer: invariant TSC @ " << 1.0 / calibration.ns_per_tick << " GHz, overhead " << calibration.overhead_ticks << " ticks" << endl;
+    } else {
+        cout << "Timer: CLOCK_MONOTONIC, overhead " << calibration.overhead_ticks << " ns" << endl;
+    }
+}
+
 // =================================================
 
 
@@ -87,134 +301,5963 @@ public:
     }
 };
 
-
-// =================================================
-
 /**
- * @brief 스레드 작업 함수 (Lock 사용)
- * @param start_val 스레드가 합산할 시작 숫자
- * @param end_val 스레드가 합산할 종료 숫자
+ * @brief 4. Reader-Writer Spin Lock 구현
+ * 상태 워드의 최상위 비트는 writer, 나머지 비트는 현재 reader 수
  */
-template<typename LockType>
-void worker_function_with_lock(LockType& lock_instance, long long& counter, int start_val, int end_val) {
-    for (int i = start_val; i <= end_val; ++i) {
-        lock_instance.lock();
-        counter += i; // Critical Section: 실제 숫자를 공유 카운터에 더함
-        lock_instance.unlock();
+class RW_Spin_Lock {
+    static constexpr uint32_t WRITER = 1u << 31;
+    std::atomic<uint32_t> state = 0;
+public:
+    void lock() {
+        while (true) {
+            if (state.load() == 0) {
+                uint32_t expected = 0;
+                if (state.compare_exchange_weak(expected, WRITER)) {
+                    return;
+                }
+            }
+        }
     }
-}
+    void unlock() {
+        state.fetch_sub(WRITER);
+    }
+    void lock_shared() {
+        while (true) {
+            while (state.load() & WRITER);
+            if (!(state.fetch_add(1) & WRITER)) {
+                return;
+            }
+            state.fetch_sub(1);
+        }
+    }
+    void unlock_shared() {
+        state.fetch_sub(1);
+    }
+};
 
 /**
- * @brief 스레드 작업 함수 (No Lock 사용)
- * @param start_val 스레드가 합산할 시작 숫자
- * @param end_val 스레드가 합산할 종료 숫자
+ * @brief 5. Optimistic Lock (OptLock) 구현
+ * 상태 워드 = (버전 << 1) | 배타 비트. reader는 공유 메모리에 쓰지 않고
+ * 읽기 전 버전을 기억해 두었다가 읽은 뒤 버전이 바뀌지 않았는지 검증한다.
  */
-void worker_function_no_lock(long long& counter, int start_val, int end_val) {
-    for (int i = start_val; i <= end_val; ++i) {
-        counter += i; // Critical Section: 실제 숫자를 공유 카운터에 더함
+class Opt_Lock {
+    std::atomic<uint64_t> version_word = 0;
+public:
+    void lock() {
+        while (true) {
+            uint64_t word = version_word.load();
+            if (!(word & 1) && version_word.compare_exchange_weak(word, word | 1)) {
+                // 이후의 데이터 쓰기가 홀수 버전보다 먼저 보이지 않게 한다 (seqlock writer 펜스)
+                std::atomic_thread_fence(std::memory_order_release);
+                return;
+            }
+        }
     }
-}
-
+    void unlock() {
+        version_word.fetch_add(1); // 배타 비트 해제와 버전 증가를 한 번에
+    }
+    uint64_t read_begin() {
+        uint64_t word;
+        while ((word = version_word.load()) & 1);
+        return word;
+    }
+    bool read_validate(uint64_t version) {
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return version_word.load(std::memory_order_relaxed) == version;
+    }
+};
 
 /**
- * @brief 실험 실행 및 결과 측정
+ * @brief Big-Reader Lock의 reader 슬롯 선택 방식
  */
-template<typename LockType>
-double run_experiment(const string& lock_name, int num_threads, bool use_lock = true) {
-    
-    // 초기화
-    shared_counter = 0;
-    LockType lock_instance;
-    
-    // [**1. 정답 계산 (가우스 공식)**]
-    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
-    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
-    long long expected_result = sum_to_end - sum_to_start_minus_1;
+enum class BR_Slot_Policy {
+    Per_CPU,    // sched_getcpu()로 현재 CPU의 슬롯 사용
+    Per_Thread  // 스레드마다 고정 슬롯 (라운드 로빈 배정)
+};
 
+/**
+ * @brief 7. Big-Reader (BR) Lock 구현
+ * CPU 수만큼 캐시 라인 단위로 분리된 reader 카운터를 두어 reader끼리는 같은 캐시 라인을
+ * 공유하지 않는다. writer는 writer 플래그를 세운 뒤 모든 슬롯이 0이 될 때까지 기다린다.
+ * (reader가 잡은 슬롯을 thread_local에 기억하므로, 한 스레드가 같은 종류의 BR Lock을
+ *  동시에 둘 이상 공유 모드로 잡아서는 안 된다.)
+ */
+template<BR_Slot_Policy Policy>
+class BR_Lock {
+    struct alignas(64) Reader_Slot {
+        std::atomic<int> readers = 0;
+    };
 
-    // [**2. 작업 범위 분배**]
-    vector<thread> threads;
-    auto start_time = chrono::high_resolution_clock::now();
-    
-    int current_start = START_NUM;
-    
-    for (int i = 0; i < num_threads; ++i) {
-        // 각 스레드가 처리할 숫자의 개수
-        int range_size = NUM_OPERATIONS / num_threads + (i < NUM_OPERATIONS % num_threads ? 1 : 0);
-        int current_end = current_start + range_size - 1;
+    int num_slots = max(1, get_nprocs_conf());
+    unique_ptr<Reader_Slot[]> slots = make_unique<Reader_Slot[]>(num_slots);
+    alignas(64) std::atomic<bool> writer = false;
 
-        if (current_end > END_NUM) { 
-            current_end = END_NUM;
-        }
+    static thread_local int held_slot;
 
-        if (use_lock) {
-            // 락을 사용하는 경우
-            threads.emplace_back(worker_function_with_lock<LockType>, ref(lock_instance), ref(shared_counter), current_start, current_end);
+    int current_slot() {
+        if constexpr (Policy == BR_Slot_Policy::Per_CPU) {
+            int cpu = sched_getcpu();
+            return cpu < 0 ? 0 : cpu % num_slots;
         } else {
-            // No Lock (락을 사용하지 않는 경우)
-            threads.emplace_back(worker_function_no_lock, ref(shared_counter), current_start, current_end);
+            static std::atomic<int> next_thread_slot = 0;
+            thread_local int thread_slot = next_thread_slot.fetch_add(1);
+            return thread_slot % num_slots;
         }
+    }
 
-        current_start = current_end + 1;
+public:
+    void lock() {
+        while (true) {
+            if (!writer.load()) {
+                bool expected = false;
+                if (writer.compare_exchange_weak(expected, true)) {
+                    break;
+                }
+            }
+        }
+        for (int i = 0; i < num_slots; ++i) {
+            while (slots[i].readers.load() != 0);
+        }
+    }
+    void unlock() {
+        writer.store(false);
     }
+    void lock_shared() {
+        while (true) {
+            int slot = current_slot();
+            slots[slot].readers.fetch_add(1);
+            if (!writer.load()) {
+                held_slot = slot;
+                return;
+            }
+            slots[slot].readers.fetch_sub(1);
+            while (writer.load());
+        }
+    }
+    void unlock_shared() {
+        slots[held_slot].readers.fetch_sub(1);
+    }
+};
 
-    // 모든 스레드 종료 대기
-    for (auto& t : threads) {
-        t.join();
+template<BR_Slot_Policy Policy>
+thread_local int BR_Lock<Policy>::held_slot = 0;
+
+// futex 시스템 콜 래퍼 (32비트 atomic 워드 위에서 대기/깨우기)
+inline void futex_wait(std::atomic<uint32_t>& word, uint32_t expected) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAIT_PRIVATE, expected, nullptr, nullptr, 0);
+}
+
+inline void futex_wake(std::atomic<uint32_t>& word, int count) {
+    syscall(SYS_futex, reinterpret_cast<uint32_t*>(&word), FUTEX_WAKE_PRIVATE, count, nullptr, nullptr, 0);
+}
+
+/**
+ * @brief 현재 스레드의 커널 TID (스레드마다 한 번만 시스템 콜)
+ */
+inline uint32_t thread_tid() {
+    thread_local uint32_t tid = uint32_t(syscall(SYS_gettid));
+    return tid;
+}
+
+/**
+ * @brief 현재 스레드의 CPU 시간 clock (pthread_getcpuclockid, 스레드마다 한 번만 조회)
+ */
+inline clockid_t thread_cpu_clock() {
+    thread_local clockid_t clock = [] {
+        clockid_t id;
+        return pthread_getcpuclockid(pthread_self(), &id) == 0 ? id : clockid_t(-1);
+    }();
+    return clock;
+}
+
+/**
+ * @brief CPU 시간 clock의 현재 값 (ns). 실행 중인 스레드도 tick을 기다리지 않고 최신 값을 돌려준다.
+ * @return 읽을 수 없으면 (스레드가 끝났거나 clock이 없으면) -1
+ */
+long long cpu_clock_ns(clockid_t clock) {
+    timespec ts;
+    if (clock == clockid_t(-1) || clock_gettime(clock, &ts) != 0) {
+        return -1;
     }
+    return ts.tv_sec * 1'000'000'000LL + ts.tv_nsec;
+}
 
-    auto end_time = chrono::high_resolution_clock::now();
-    chrono::duration<double> duration = end_time - start_time;
-    
-    // 결과 출력
-    cout << lock_name << " (" << num_threads << " threads): ";
-    cout << "Time = " << duration.count() * 1000 << " ms, ";
-    
-    // [**3. 정확성 검증**]
-    bool is_correct = (shared_counter == expected_result);
-    
-    cout << "Final Sum = " << shared_counter;
-    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+/**
+ * @brief 락 소유자 선점 대응 방식
+ */
+enum class LHP_Policy {
+    Spin,  // 감지만 하고 계속 스핀
+    Yield, // 소유자가 CPU를 잃었으면 sched_yield()
+    Park   // 소유자가 CPU를 잃었으면 futex로 잠든다
+};
 
-    if (!is_correct) {
-        cout << ", Error = " << abs(shared_counter - expected_result);
+// 선점 감지 통계 (느린 경로에서만 갱신)
+std::atomic<long long> g_lhp_long_holds = 0;
+std::atomic<long long> g_lhp_preempted_holders = 0;
+
+/**
+ * @brief 8. Preemption-Aware (LHP) Lock 구현
+ * 락 워드에 소유자 TID를 기록한다(0 = 해제, 최상위 비트 = 잠든 대기자 있음).
+ * 오래 스핀한 대기자는 소유자의 획득 시각으로 긴 보유를 감지하고, 소유자의
+ * CPU 시간 clock이 잠시 동안 늘지 않으면 소유자가 CPU를 잃은 것으로 보고 Policy대로 대응한다.
+ * 통계는 보유(획득 시각)마다 한 번만 센다.
+ */
+template<LHP_Policy Policy>
+class LHP_Lock {
+    static constexpr uint32_t WAITERS = 0x80000000u;
+    static constexpr uint32_t TID_MASK = 0x3fffffffu;
+    static constexpr int DETECT_SPINS = 10'000;
+    static constexpr auto LONG_HOLD = chrono::microseconds(100);
+    static constexpr auto RUNTIME_PROBE = chrono::microseconds(20);
+
+    std::atomic<uint32_t> owner = 0;
+    std::atomic<uint64_t> acquired_at = 0;   // timer_now() tick, 보유마다 다르므로 보유의 식별자로도 쓴다
+    std::atomic<clockid_t> holder_clock = -1; // 소유자의 CPU 시간 clock
+    std::atomic<uint64_t> counted_long_hold = 0;
+    std::atomic<uint64_t> counted_preempted_hold = 0;
+
+    void on_acquire() {
+        holder_clock.store(thread_cpu_clock(), std::memory_order_relaxed);
+        acquired_at.store(timer_now(), std::memory_order_release);
     }
-    cout << endl;
 
-    return duration.count();
-}
+    // 이 보유(획득 시각 hold)를 아직 아무도 세지 않았으면 true
+    static bool first_to_count(std::atomic<uint64_t>& counted, uint64_t hold) {
+        uint64_t seen = counted.load();
+        return seen != hold && counted.compare_exchange_strong(seen, hold);
+    }
 
+    // 잠시 간격을 두고 소유자의 CPU 시간을 두 번 읽어 변화가 없으면 CPU를 잃은 것으로 판단
+    bool holder_off_cpu(uint32_t holder, clockid_t clock) {
+        long long before = cpu_clock_ns(clock);
+        if (before < 0) {
+            return false; // clock을 읽을 수 없으면 (소유자가 이미 바뀌어 끝난 스레드 등) 판단하지 않는다
+        }
+        uint64_t probe_end = timer_now() + timer_ticks_from_ns(chrono::nanoseconds(RUNTIME_PROBE).count());
+        while (timer_now() < probe_end) {
+            if ((owner.load() & TID_MASK) != holder) {
+                return false;
+            }
+        }
+        return cpu_clock_ns(clock) == before;
+    }
 
-// =================================================
+public:
+    void lock() {
+        uint32_t self = thread_tid();
+        uint32_t word = 0;
+        if (owner.compare_exchange_strong(word, self)) {
+            on_acquire();
+            return;
+        }
 
-int main() {
-    
-    // 정답을 미리 출력 (1,000,000 부터 5,000,000 까지의 합)
-    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
-    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
-    long long true_expected_result = sum_to_end - sum_to_start_minus_1;
+        bool parked = false;
+        int spins = 0;
+        while (true) {
+            word = owner.load();
+            if ((word & TID_MASK) == 0) {
+                // 잠들었던 적이 있으면 다른 대기자를 위해 WAITERS 비트를 유지한다
+                if (owner.compare_exchange_weak(word, parked ? (self | WAITERS) : self)) {
+                    on_acquire();
+                    return;
+                }
+                continue;
+            }
+            if (++spins < DETECT_SPINS) {
+                continue;
+            }
+            spins = 0;
 
-    cout << "===== Lock Mechanism Performance Evaluation =====" << endl;
-    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
-    cout << "True Expected Result (Final Sum): " << true_expected_result << endl;
+            uint64_t held_since = acquired_at.load(std::memory_order_acquire); // 먼저 읽어야 now - held_since가 음수가 되지 않는다
+            clockid_t clock = holder_clock.load(std::memory_order_relaxed);
+            long long held_for_ns = timer_elapsed_ns(held_since, timer_now());
+            if (held_for_ns < chrono::nanoseconds(LONG_HOLD).count()) {
+                continue;
+            }
+            if (first_to_count(counted_long_hold, held_since)) {
+                ++g_lhp_long_holds;
+            }
+            if (!holder_off_cpu(word & TID_MASK, clock)) {
+                continue;
+            }
+            if (first_to_count(counted_preempted_hold, held_since)) {
+                ++g_lhp_preempted_holders;
+            }
 
+            if constexpr (Policy == LHP_Policy::Yield) {
+                sched_yield();
+            } else if constexpr (Policy == LHP_Policy::Park) {
+                if ((word & WAITERS) || owner.compare_exchange_strong(word, word | WAITERS)) {
+                    futex_wait(owner, word | WAITERS);
+                    parked = true;
+                }
+            }
+        }
+    }
+    void unlock() {
+        if (owner.exchange(0) & WAITERS) {
+            futex_wake(owner, 1);
+        }
+    }
+};
 
-    vector<int> thread_counts = {2, 4, 8, 16, 32};
+/**
+ * @brief 선점 감지 통계 출력 후 초기화
+ */
+void report_lhp_stats() {
+    cout << "    LHP: Long Holds = " << g_lhp_long_holds.exchange(0);
+    cout << ", Preempted Holders = " << g_lhp_preempted_holders.exchange(0) << endl;
+}
 
-    for (int num_threads : thread_counts) {
-        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
-        
-        // 1. No Lock
-        run_experiment<TAS_Lock>("No Lock", num_threads, false);
+/**
+ * @brief 9. Hybrid (Spin-then-Park) Lock 구현
+ * 잠시 스핀해 보고 얻지 못하면 futex로 잠든다. (상태: 0 = 해제, 1 = 잠김, 2 = 잠김 + 대기자)
+ */
+class Hybrid_Lock {
+    static constexpr int SPIN_LIMIT = 100;
+    std::atomic<uint32_t> state = 0;
+public:
+    void lock() {
+        for (int i = 0; i < SPIN_LIMIT; ++i) {
+            if (state.load() == 0) {
+                uint32_t expected = 0;
+                if (state.compare_exchange_weak(expected, 1)) {
+                    return;
+                }
+            }
+        }
+        uint32_t current = state.exchange(2);
+        while (current != 0) {
+            futex_wait(state, 2);
+            current = state.exchange(2);
+        }
+    }
+    void unlock() {
+        if (state.exchange(0) == 2) {
+            futex_wake(state, 1);
+        }
+    }
+};
 
-        // 2. TAS Lock
-        run_experiment<TAS_Lock>("TAS Lock", num_threads);
-        
-        // 3. TTAS Lock
-        run_experiment<TTAS_Lock>("TTAS Lock", num_threads);
+/**
+ * @brief 10. Priority-Inheritance (PI) Lock 구현
+ * 락 워드에 소유자 TID를 기록하고, 경합 시 FUTEX_LOCK_PI로 커널에 맡긴다.
+ * 커널은 대기 중인 가장 높은 우선순위를 소유자에게 상속해 우선순위 역전을 막는다.
+ */
+class PI_Lock {
+    std::atomic<uint32_t> owner = 0;
 
-        // 4. Backoff Lock
-        run_experiment<Backoff_Lock>("Backoff Lock", num_threads);
+    [[noreturn]] static void fail(const char* operation) {
+        cerr << "PI Lock: " << operation << " failed: " << strerror(errno) << endl;
+        abort();
+    }
+public:
+    void lock() {
+        uint32_t expected = 0;
+        if (owner.compare_exchange_strong(expected, thread_tid())) {
+            return;
+        }
+        // EINTR/EAGAIN(소유자가 막 바뀌는 중)만 재시도하고, ENOSYS/EPERM/EDEADLK 같은 영구 실패는 중단한다
+        while (syscall(SYS_futex, reinterpret_cast<uint32_t*>(&owner), FUTEX_LOCK_PI_PRIVATE, 0, nullptr, nullptr, 0) != 0) {
+            if (errno != EINTR && errno != EAGAIN) {
+                fail("FUTEX_LOCK_PI");
+            }
+        }
+    }
+    void unlock() {
+        uint32_t expected = thread_tid();
+        if (owner.compare_exchange_strong(expected, 0)) {
+            return;
+        }
+        if (syscall(SYS_futex, reinterpret_cast<uint32_t*>(&owner), FUTEX_UNLOCK_PI_PRIVATE, 0, nullptr, nullptr, 0) != 0) {
+            fail("FUTEX_UNLOCK_PI");
+        }
+    }
+};
+
+/**
+ * @brief 전역 Parking Lot (WebKit ParkingLot / Rust parking_lot 방식)
+ * 락 객체 주소를 해시해 고른 버킷에 대기 스레드 큐를 두므로, 락 자체에는
+ * 대기자 정보를 둘 필요가 없다. 대기자는 스레드마다 하나인 futex 워드에서 잠든다.
+ */
+class Parking_Lot {
+    struct Thread_Data {
+        const void* address = nullptr;
+        std::atomic<uint32_t> ready = 0;
+        Thread_Data* next = nullptr;
+    };
+
+    struct alignas(64) Bucket {
+        std::mutex mutex;
+        Thread_Data* head = nullptr;
+        Thread_Data* tail = nullptr;
+    };
+
+    static constexpr int NUM_BUCKETS = 1024;
+    Bucket buckets[NUM_BUCKETS];
+
+    Bucket& bucket_of(const void* address) {
+        uintptr_t key = reinterpret_cast<uintptr_t>(address);
+        return buckets[(key * 0x9E3779B97F4A7C15ull) >> 54];
+    }
+
+public:
+    /**
+     * @brief validate()가 true이면 address에서 잠든다 (validate는 버킷 락을 잡은 채 호출)
+     * @return 실제로 잠들었다가 깨어났으면 true
+     */
+    template<typename Validate>
+    bool park(const void* address, Validate validate) {
+        thread_local Thread_Data me;
+        Bucket& bucket = bucket_of(address);
+        {
+            std::lock_guard<std::mutex> guard(bucket.mutex);
+            if (!validate()) {
+                return false;
+            }
+            me.address = address;
+            me.ready.store(0);
+            me.next = nullptr;
+            if (bucket.tail != nullptr) {
+                bucket.tail->next = &me;
+            } else {
+                bucket.head = &me;
+            }
+            bucket.tail = &me;
+        }
+        while (me.ready.load() == 0) {
+            futex_wait(me.ready, 0);
+        }
+        return true;
+    }
+
+    /**
+     * @brief address에서 잠든 스레드 하나를 FIFO 순서로 깨운다
+     * @param callback 버킷 락을 잡은 채 (같은 주소에 대기자가 더 남았는지)를 인자로 호출
+     */
+    template<typename Callback>
+    void unpark_one(const void* address, Callback callback) {
+        Bucket& bucket = bucket_of(address);
+        Thread_Data* woken = nullptr;
+        {
+            std::lock_guard<std::mutex> guard(bucket.mutex);
+            Thread_Data* prev = nullptr;
+            for (Thread_Data* t = bucket.head; t != nullptr; prev = t, t = t->next) {
+                if (t->address == address) {
+                    woken = t;
+                    (prev != nullptr ? prev->next : bucket.head) = t->next;
+                    if (bucket.tail == t) {
+                        bucket.tail = prev;
+                    }
+                    break;
+                }
+            }
+            bool more_waiters = false;
+            for (Thread_Data* t = bucket.head; t != nullptr && !more_waiters; t = t->next) {
+                more_waiters = (t->address == address);
+            }
+            callback(more_waiters);
+        }
+        if (woken != nullptr) {
+            woken->ready.store(1);
+            futex_wake(woken->ready, 1);
+        }
+    }
+};
+
+Parking_Lot g_parking_lot;
+
+/**
+ * @brief 11. Parking Lot Lock 구현 (1바이트 워드 락)
+ * LOCKED / PARKED 두 비트만 객체에 두고, 경합 시 잠시 스핀한 뒤 전역 Parking Lot에서 잠든다.
+ * 해제하는 스레드는 한 명만 깨우고 락은 비워 두므로, 깨어난 스레드는 다시 경쟁한다.
+ */
+class Parking_Lot_Lock {
+    static constexpr uint8_t LOCKED = 1;
+    static constexpr uint8_t PARKED = 2;
+    static constexpr int SPIN_LIMIT = 40;
+    std::atomic<uint8_t> bits = 0;
+public:
+    void lock() {
+        uint8_t expected = 0;
+        if (bits.compare_exchange_weak(expected, LOCKED)) {
+            return;
+        }
+        int spins = 0;
+        while (true) {
+            uint8_t current = bits.load();
+            if (!(current & LOCKED)) {
+                if (bits.compare_exchange_weak(current, current | LOCKED)) {
+                    return;
+                }
+                continue;
+            }
+            if (!(current & PARKED) && spins < SPIN_LIMIT) {
+                ++spins;
+                this_thread::yield();
+                continue;
+            }
+            if (!(current & PARKED) && !bits.compare_exchange_weak(current, current | PARKED)) {
+                continue;
+            }
+            g_parking_lot.park(&bits, [&] { return bits.load() == (LOCKED | PARKED); });
+        }
+    }
+    void unlock() {
+        uint8_t expected = LOCKED;
+        if (bits.compare_exchange_strong(expected, 0)) {
+            return;
+        }
+        g_parking_lot.unpark_one(&bits, [&](bool more_waiters) {
+            bits.store(more_waiters ? PARKED : 0);
+        });
+    }
+};
+
+// GCR 활성 집합 상한 (--gcr-limit=N, 옛 이름 --active=N). 내부 락을 포화시킬 만큼만 남기도록 작게 둔다.
+constexpr int GCR_DEFAULT_ACTIVE_LIMIT = 2;
+int g_gcr_active_limit = GCR_DEFAULT_ACTIVE_LIMIT;
+// GCR 통계 (느린 경로에서만 갱신)
+std::atomic<long long> g_gcr_passive_entries = 0;
+std::atomic<long long> g_gcr_rotations = 0;
+
+/**
+ * @brief 12. GCR (Generic Concurrency Restriction) 래퍼 구현
+ * 내부 락에 동시에 접근하는 활성 스레드 수를 제한하고, 나머지는 MCS식 수동 큐에서 잠든다.
+ * 수동 큐의 맨 앞 스레드만 깨어 있으며, 활성 자리가 나면 들어간다. 활성 스레드가 자리를
+ * 독점하지 않도록 ROTATION_PERIOD번의 해제가 지나면 맨 앞 스레드가 상한을 넘겨 강제로 들어간다.
+ */
+template<typename LockType>
+class GCR_Lock {
+    static constexpr long long ROTATION_PERIOD = 1024;
+
+    struct Passive_Node {
+        std::atomic<Passive_Node*> next = nullptr;
+        std::atomic<uint32_t> is_head = 0;
+    };
+
+    LockType inner;
+    std::atomic<int> active = 0;
+    std::atomic<Passive_Node*> passive_tail = nullptr;
+    std::atomic<long long> releases = 0;
+
+    static int active_limit() {
+        return max(1, g_gcr_active_limit);
+    }
+
+    bool try_enter(int limit) {
+        int current = active.load();
+        while (current < limit) {
+            if (active.compare_exchange_weak(current, current + 1)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void enter_passive(int limit) {
+        Passive_Node node;
+        Passive_Node* prev = passive_tail.exchange(&node);
+        if (prev != nullptr) {
+            prev->next.store(&node);
+            while (node.is_head.load() == 0) {
+                futex_wait(node.is_head, 0);
+            }
+        }
+        ++g_gcr_passive_entries;
+
+        // 맨 앞: 자리가 나기를 기다리되, 너무 오래 걸리면 활성 집합을 순환시킨다
+        long long waited_from = releases.load();
+        while (!try_enter(limit)) {
+            if (releases.load() - waited_from >= ROTATION_PERIOD) {
+                active.fetch_add(1);
+                ++g_gcr_rotations;
+                break;
+            }
+            this_thread::yield();
+        }
+
+        // 맨 앞 자리를 후계자에게 넘긴다
+        Passive_Node* expected = &node;
+        if (passive_tail.compare_exchange_strong(expected, nullptr)) {
+            return;
+        }
+        Passive_Node* successor;
+        while ((successor = node.next.load()) == nullptr);
+        successor->is_head.store(1);
+        futex_wake(successor->is_head, 1);
+    }
+
+public:
+    void lock() {
+        int limit = active_limit();
+        if (!try_enter(limit)) {
+            enter_passive(limit);
+        }
+        inner.lock();
+    }
+    void unlock() {
+        inner.unlock();
+        releases.fetch_add(1);
+        active.fetch_sub(1);
+    }
+};
+
+/**
+ * @brief GCR 통계 출력 후 초기화
+ */
+void report_gcr_stats() {
+    cout << "    GCR: Passive Entries = " << g_gcr_passive_entries.exchange(0);
+    cout << ", Rotations = " << g_gcr_rotations.exchange(0) << endl;
+}
+
+/**
+ * @brief 현재 스레드를 cpu에 고정한다
+ * @return 고정에 실패하면 false
+ */
+bool pin_thread_to_cpu(int cpu) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+        return false;
+    }
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(cpu, &set);
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+/**
+ * @brief 이 프로세스가 실행될 수 있는 CPU 목록 (taskset/cpuset 마스크)
+ */
+vector<int> allowed_cpus() {
+    vector<int> cpus;
+    cpu_set_t mask;
+    if (sched_getaffinity(0, sizeof(mask), &mask) == 0) {
+        for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+            if (CPU_ISSET(cpu, &mask)) {
+                cpus.push_back(cpu);
+            }
+        }
+    }
+    return cpus;
+}
+
+// 비어 있지 않으면 run_experiment의 스레드 i를 g_pinned_cpus[i % 크기]에 고정한다 (--pin=0,2,4)
+vector<int> g_pinned_cpus;
+// 마지막 run_experiment에서 고정에 실패한 스레드 수
+std::atomic<int> g_pin_failures = 0;
+
+/**
+ * @brief "0,2,4" 형식의 CPU 목록 파싱
+ */
+vector<int> parse_cpu_list(const string& text) {
+    vector<int> cpus;
+    size_t begin = 0;
+    while (begin < text.size()) {
+        size_t end = text.find(',', begin);
+        if (end == string::npos) {
+            end = text.size();
+        }
+        if (end > begin) {
+            cpus.push_back(stoi(text.substr(begin, end - begin)));
+        }
+        begin = end + 1;
+    }
+    return cpus;
+}
+
+// 0보다 크면 실제 토폴로지 대신 스레드를 번갈아 가상 소켓에 배정한다 (단일 소켓 머신에서 CNA 관찰용)
+int g_virtual_sockets = 0;
+
+/**
+ * @brief 현재 스레드가 실행 중인 소켓 번호
+ * CPU별 physical_package_id는 처음 한 번만 /sys에서 읽는다.
+ */
+int current_socket() {
+    if (g_virtual_sockets > 0) {
+        static std::atomic<int> next_thread = 0;
+        thread_local int virtual_socket = next_thread++ % g_virtual_sockets;
+        return virtual_socket;
+    }
+    static const vector<int> cpu_sockets = [] {
+        vector<int> sockets(max(1, get_nprocs_conf()), 0);
+        for (size_t cpu = 0; cpu < sockets.size(); ++cpu) {
+            char path[96];
+            snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%zu/topology/physical_package_id", cpu);
+            if (FILE* file = fopen(path, "r")) {
+                if (fscanf(file, "%d", &sockets[cpu]) != 1) {
+                    sockets[cpu] = 0;
+                }
+                fclose(file);
+            }
+        }
+        return sockets;
+    }();
+    int cpu = sched_getcpu();
+    return (cpu >= 0 && cpu < int(cpu_sockets.size())) ? cpu_sockets[cpu] : 0;
+}
+
+/**
+ * @brief 조건이 참이 될 때까지 스핀하되, 오래 걸리면 CPU를 양보한다
+ * FIFO 락은 정해진 다음 대기자만 진행할 수 있어서, 그 대기자가 CPU를 잃었을 때 순수 스핀은 타임슬라이스 단위로 멈춘다.
+ */
+template<typename Predicate>
+void spin_until(Predicate done) {
+    constexpr int SPIN_LIMIT = 100;
+    for (int spins = 0; !done(); ++spins) {
+        if (spins >= SPIN_LIMIT) {
+            this_thread::yield();
+        }
+    }
+}
+
+/**
+ * @brief 13. Ticket Lock 구현
+ * 번호표를 뽑고 자기 차례가 될 때까지 스핀한다 (FIFO).
+ */
+class Ticket_Lock {
+    std::atomic<uint32_t> next_ticket = 0;
+    std::atomic<uint32_t> now_serving = 0;
+public:
+    void lock() {
+        uint32_t ticket = next_ticket.fetch_add(1);
+        spin_until([&] { return now_serving.load() == ticket; });
+    }
+    void unlock() {
+        now_serving.store(now_serving.load() + 1);
+    }
+};
+
+/**
+ * @brief MCS/CNA 큐 노드 (스레드마다 몇 개씩 두고 돌려 쓴다)
+ * spin: 0 = 대기, 1 = 락 획득, 그 외 = 락 획득 + CNA 보조 큐의 머리 노드 주소
+ */
+struct alignas(64) Queue_Lock_Node {
+    std::atomic<uintptr_t> spin = 0;
+    std::atomic<Queue_Lock_Node*> next = nullptr;
+    int socket = -1;
+    Queue_Lock_Node* secondary_tail = nullptr;
+    const void* held_lock = nullptr; // 이 노드로 잡은 락 (빈 노드면 nullptr)
+};
+
+/**
+ * @brief 현재 스레드의 큐 노드 중 lock을 잡는 데 쓴 노드를 찾는다 (lock이 nullptr이면 빈 노드)
+ * 노드를 스레드마다 여러 개 두어, 락을 한 워드로 유지하면서도 여러 락을 동시에 잡을 수 있다.
+ */
+Queue_Lock_Node* find_queue_node(const void* lock) {
+    constexpr int NODES_PER_THREAD = 8;
+    thread_local Queue_Lock_Node nodes[NODES_PER_THREAD];
+    for (auto& node : nodes) {
+        if (node.held_lock == lock) {
+            return &node;
+        }
+    }
+    cerr << "Too many queue locks held by one thread" << endl;
+    abort();
+}
+
+/**
+ * @brief 14. MCS Lock 구현
+ * 각 대기자는 자기 노드에서만 스핀하고, 해제 시 큐의 다음 노드에 직접 넘긴다.
+ */
+class MCS_Lock {
+    std::atomic<Queue_Lock_Node*> tail = nullptr;
+public:
+    void lock() {
+        Queue_Lock_Node* node = find_queue_node(nullptr);
+        node->held_lock = this;
+        node->next.store(nullptr);
+        node->spin.store(0);
+        Queue_Lock_Node* prev = tail.exchange(node);
+        if (prev != nullptr) {
+            prev->next.store(node);
+            spin_until([&] { return node->spin.load() != 0; });
+        }
+    }
+    void unlock() {
+        Queue_Lock_Node* node = find_queue_node(this);
+        Queue_Lock_Node* successor = node->next.load();
+        if (successor == nullptr) {
+            Queue_Lock_Node* expected = node;
+            if (tail.compare_exchange_strong(expected, nullptr)) {
+                node->held_lock = nullptr;
+                return;
+            }
+            spin_until([&] { return (successor = node->next.load()) != nullptr; });
+        }
+        successor->spin.store(1);
+        node->held_lock = nullptr;
+    }
+};
+
+/**
+ * @brief 15. CNA (Compact NUMA-Aware) Lock 구현 (Dice & Kogan, EuroSys '19)
+ * 락 자체는 MCS처럼 tail 포인터 한 워드다. 해제 시 같은 소켓의 대기자를 찾아 넘기고,
+ * 건너뛴 다른 소켓 대기자는 보조 큐로 옮긴다. 보조 큐 위치는 spin 값으로 함께 넘겨지며,
+ * 약 1/FAIRNESS_THRESHOLD 확률로 보조 큐를 주 큐 앞에 되돌려 기아를 막는다.
+ */
+class CNA_Lock {
+    static constexpr uint32_t FAIRNESS_THRESHOLD = 256;
+    std::atomic<Queue_Lock_Node*> tail = nullptr;
+
+    static bool keep_lock_local() {
+        thread_local uint32_t seed = 2463534242u ^ thread_tid();
+        seed ^= seed << 13;
+        seed ^= seed >> 17;
+        seed ^= seed << 5;
+        return seed % FAIRNESS_THRESHOLD != 0;
+    }
+
+    // 주 큐에서 같은 소켓의 첫 대기자를 찾고, 그 앞의 다른 소켓 대기자들은 보조 큐로 옮긴다
+    static Queue_Lock_Node* find_successor(Queue_Lock_Node* node) {
+        Queue_Lock_Node* next = node->next.load();
+        int my_socket = node->socket >= 0 ? node->socket : current_socket();
+        if (next->socket == my_socket) {
+            return next;
+        }
+        Queue_Lock_Node* skipped_head = next;
+        Queue_Lock_Node* skipped_tail = next;
+        for (Queue_Lock_Node* current = next->next.load(); current != nullptr; current = current->next.load()) {
+            if (current->socket == my_socket) {
+                uintptr_t secondary = node->spin.load();
+                if (secondary > 1) {
+                    auto* secondary_head = reinterpret_cast<Queue_Lock_Node*>(secondary);
+                    secondary_head->secondary_tail->next.store(skipped_head);
+                    secondary_head->secondary_tail = skipped_tail;
+                } else {
+                    skipped_head->secondary_tail = skipped_tail;
+                    node->spin.store(reinterpret_cast<uintptr_t>(skipped_head));
+                }
+                skipped_tail->next.store(nullptr);
+                return current;
+            }
+            skipped_tail = current;
+        }
+        return nullptr;
+    }
+
+public:
+    void lock() {
+        Queue_Lock_Node* node = find_queue_node(nullptr);
+        node->held_lock = this;
+        node->next.store(nullptr);
+        node->spin.store(0);
+        node->socket = -1;
+        Queue_Lock_Node* prev = tail.exchange(node);
+        if (prev == nullptr) {
+            node->spin.store(1);
+        } else {
+            node->socket = current_socket();
+            prev->next.store(node);
+            spin_until([&] { return node->spin.load() != 0; });
+        }
+    }
+    void unlock() {
+        Queue_Lock_Node* node = find_queue_node(this);
+        uintptr_t secondary = node->spin.load();
+        if (node->next.load() == nullptr) {
+            if (secondary == 1) {
+                Queue_Lock_Node* expected = node;
+                if (tail.compare_exchange_strong(expected, nullptr)) {
+                    node->held_lock = nullptr;
+                    return;
+                }
+            } else {
+                // 주 큐가 비었으면 보조 큐를 그대로 주 큐로 삼는다
+                auto* secondary_head = reinterpret_cast<Queue_Lock_Node*>(secondary);
+                Queue_Lock_Node* expected = node;
+                if (tail.compare_exchange_strong(expected, secondary_head->secondary_tail)) {
+                    secondary_head->spin.store(1);
+                    node->held_lock = nullptr;
+                    return;
+                }
+            }
+            spin_until([&] { return node->next.load() != nullptr; });
+        }
+
+        Queue_Lock_Node* successor = nullptr;
+        if (keep_lock_local() && (successor = find_successor(node)) != nullptr) {
+            successor->spin.store(node->spin.load());
+        } else if ((secondary = node->spin.load()) > 1) {
+            // 보조 큐를 주 큐 앞에 이어 붙이고 보조 큐의 머리에게 넘긴다
+            successor = reinterpret_cast<Queue_Lock_Node*>(secondary);
+            successor->secondary_tail->next.store(node->next.load());
+            successor->spin.store(1);
+        } else {
+            node->next.load()->spin.store(1);
+        }
+        node->held_lock = nullptr;
+    }
+};
+
+// 연속한 두 소유자가 서로 다른 소켓인 락 전달 횟수
+std::atomic<long long> g_cross_socket_handoffs = 0;
+std::atomic<long long> g_lock_handoffs = 0;
+
+/**
+ * @brief 락 소유자가 다른 스레드로 바뀔 때 소켓 간 이동을 세는 래퍼 (락 자체의 크기는 바꾸지 않는다)
+ * 같은 스레드의 재획득은 전달로 세지 않으며, 소켓 조회(sched_getcpu)도 소유자가 바뀔 때만 한다.
+ * 카운터는 락으로 보호되므로 원자적일 필요가 없고, 소멸 시 전역 통계에 더한다.
+ */
+template<typename LockType>
+class Handoff_Counted_Lock {
+    LockType inner;
+    const void* last_owner = nullptr;
+    int last_socket = -1;
+    long long handoffs = 0;
+    long long cross_socket_handoffs = 0;
+
+    static const void* thread_tag() {
+        thread_local char tag;
+        return &tag;
+    }
+public:
+    ~Handoff_Counted_Lock() {
+        g_lock_handoffs += handoffs;
+        g_cross_socket_handoffs += cross_socket_handoffs;
+    }
+    void lock() {
+        inner.lock();
+        const void* me = thread_tag();
+        if (me == last_owner) {
+            return;
+        }
+        int socket = current_socket();
+        if (last_owner != nullptr) {
+            ++handoffs;
+            cross_socket_handoffs += (socket != last_socket);
+        }
+        last_owner = me;
+        last_socket = socket;
+    }
+    void unlock() {
+        inner.unlock();
+    }
+};
+
+/**
+ * @brief 소켓 간 락 전달 통계 출력 후 초기화
+ */
+void report_handoff_stats() {
+    long long handoffs = g_lock_handoffs.exchange(0);
+    long long cross = g_cross_socket_handoffs.exchange(0);
+    cout << "    Handoffs: Cross-Socket = " << cross << " / " << handoffs;
+    cout << " (" << (handoffs > 0 ? 100.0 * cross / handoffs : 0.0) << "%)" << endl;
+}
+
+constexpr size_t POOL_SLAB_SIZE = 64 * 1024;          // 슬랩 크기 (슬랩 주소는 이 크기로 정렬)
+constexpr size_t POOL_SIZE_CLASS_BYTES = 16;          // 크기 클래스 간격
+constexpr size_t POOL_MAX_BLOCK_SIZE = 1024;          // 이보다 큰 요청은 시스템 할당자로
+constexpr int POOL_SIZE_CLASSES = POOL_MAX_BLOCK_SIZE / POOL_SIZE_CLASS_BYTES;
+
+// false면 워크로드 노드도 시스템 할당자를 쓴다 (--allocator=system, 할당이 일어나기 전에만 바꾼다)
+bool g_use_node_pool = true;
+
+/**
+ * @brief 워크로드 노드용 스레드별 슬랩 할당자
+ * 스레드마다 힙을 하나 갖고, 힙은 크기 클래스별로 자기 슬랩에서 잘라 낸 블록의 지역 free 리스트를 둔다.
+ * 슬랩은 소유 스레드가 직접 잘라 링크를 쓰므로 first-touch 정책에 따라 그 스레드의 NUMA 노드에 놓인다.
+ * 다른 스레드가 해제한 블록은 소유 힙의 원격 free 리스트에 CAS로 push되고, 소유자가 지역 리스트가
+ * 비었을 때 exchange로 통째로 가져간다 (pop이 없으므로 ABA가 없다).
+ * 종료된 스레드의 힙은 버리지 않고 새 스레드가 물려받는다. 메모리는 OS에 돌려주지 않는다.
+ */
+class Node_Pool {
+    struct Free_Block {
+        Free_Block* next;
+    };
+
+    struct Thread_Heap {
+        Free_Block* local[POOL_SIZE_CLASSES] = {};
+        std::atomic<Free_Block*> remote[POOL_SIZE_CLASSES] = {};
+        bool in_use = false; // registry_lock으로 보호됨
+    };
+
+    struct alignas(POOL_SIZE_CLASS_BYTES) Slab_Header {
+        Thread_Heap* owner;
+    };
+
+    std::mutex registry_lock;
+    vector<Thread_Heap*> heaps;
+
+    Thread_Heap* thread_heap() {
+        struct Heap_Handle {
+            Node_Pool* pool = nullptr;
+            Thread_Heap* heap = nullptr;
+            ~Heap_Handle() {
+                if (heap != nullptr) {
+                    lock_guard<std::mutex> guard(pool->registry_lock);
+                    heap->in_use = false;
+                }
+            }
+        };
+        thread_local Heap_Handle handle;
+        if (handle.heap == nullptr) {
+            lock_guard<std::mutex> guard(registry_lock);
+            for (Thread_Heap* heap : heaps) {
+                if (!heap->in_use) {
+                    handle.heap = heap;
+                    break;
+                }
+            }
+            if (handle.heap == nullptr) {
+                handle.heap = new Thread_Heap;
+                heaps.push_back(handle.heap);
+            }
+            handle.heap->in_use = true;
+            handle.pool = this;
+        }
+        return handle.heap;
+    }
+
+    static Free_Block* carve_slab(Thread_Heap* heap, int size_class) {
+        size_t block_size = (size_class + 1) * POOL_SIZE_CLASS_BYTES;
+        char* slab = static_cast<char*>(aligned_alloc(POOL_SLAB_SIZE, POOL_SLAB_SIZE));
+        if (slab == nullptr) {
+            throw std::bad_alloc();
+        }
+        reinterpret_cast<Slab_Header*>(slab)->owner = heap;
+
+        size_t num_blocks = (POOL_SLAB_SIZE - sizeof(Slab_Header)) / block_size;
+        Free_Block* head = nullptr;
+        for (size_t i = num_blocks; i-- > 0;) {
+            Free_Block* block = reinterpret_cast<Free_Block*>(slab + sizeof(Slab_Header) + i * block_size);
+            block->next = head;
+            head = block;
+        }
+        return head;
+    }
+
+public:
+    void* allocate(size_t size) {
+        if (!g_use_node_pool || size > POOL_MAX_BLOCK_SIZE) {
+            return ::operator new(size);
+        }
+        int size_class = (size - 1) / POOL_SIZE_CLASS_BYTES;
+        Thread_Heap* heap = thread_heap();
+        Free_Block* block = heap->local[size_class];
+        if (block == nullptr) {
+            block = heap->remote[size_class].exchange(nullptr);
+            if (block == nullptr) {
+                block = carve_slab(heap, size_class);
+            }
+        }
+        heap->local[size_class] = block->next;
+        return block;
+    }
+
+    void deallocate(void* pointer, size_t size) {
+        if (!g_use_node_pool || size > POOL_MAX_BLOCK_SIZE) {
+            ::operator delete(pointer);
+            return;
+        }
+        int size_class = (size - 1) / POOL_SIZE_CLASS_BYTES;
+        Free_Block* block = static_cast<Free_Block*>(pointer);
+        Thread_Heap* owner = reinterpret_cast<Slab_Header*>(reinterpret_cast<uintptr_t>(pointer) & ~(POOL_SLAB_SIZE - 1))->owner;
+        if (owner == thread_heap()) {
+            block->next = owner->local[size_class];
+            owner->local[size_class] = block;
+            return;
+        }
+        Free_Block* old_head = owner->remote[size_class].load();
+        do {
+            block->next = old_head;
+        } while (!owner->remote[size_class].compare_exchange_weak(old_head, block));
+    }
+};
+
+Node_Pool g_node_pool;
+
+constexpr int RECLAIM_STATS_FLUSH = 32; // 스레드별 retire 횟수를 이만큼 모아 공유 통계에 반영
+
+/**
+ * @brief 회수 대상 노드 (큐와 스택이 함께 쓴다)
+ */
+struct Reclaim_Node {
+    long long value;
+    std::atomic<Reclaim_Node*> next = nullptr;
+    uint64_t retired_at = 0; // retire된 시각 (timer_now() tick)
+
+    static void* operator new(size_t size) { return g_node_pool.allocate(size); }
+    static void operator delete(void* pointer, size_t size) { g_node_pool.deallocate(pointer, size); }
+};
+
+/**
+ * @brief 회수 통계 (retire됐지만 아직 해제되지 않은 노드 수의 최고치, retire부터 해제까지의 지연)
+ * retire 수는 스레드별로 RECLAIM_STATS_FLUSH개씩 모아 반영하므로 최고치는 그만큼의 오차를 가진다.
+ */
+class Reclaim_Stats {
+    alignas(64) std::atomic<long long> unfreed = 0;
+    std::atomic<long long> high_water = 0;
+    std::atomic<long long> freed = 0;
+    std::atomic<long long> latency_ns = 0;
+public:
+    void add_retired(long long count) {
+        long long now_unfreed = unfreed.fetch_add(count) + count;
+        long long current = high_water.load();
+        while (now_unfreed > current && !high_water.compare_exchange_weak(current, now_unfreed));
+    }
+
+    // nodes를 해제하고 통계에 반영한다
+    void free_nodes(vector<Reclaim_Node*>& nodes) {
+        if (nodes.empty()) {
+            return;
+        }
+        uint64_t now = timer_now();
+        long long total_latency = 0;
+        for (Reclaim_Node* node : nodes) {
+            total_latency += timer_elapsed_ns(node->retired_at, now);
+            delete node;
+        }
+        unfreed.fetch_sub(nodes.size());
+        freed.fetch_add(nodes.size());
+        latency_ns.fetch_add(total_latency);
+        nodes.clear();
+    }
+
+    void report() const {
+        long long count = freed.load();
+        cout << "Unfreed HWM = " << high_water.load() << " nodes, ";
+        cout << "Reclaim Latency = " << (count > 0 ? double(latency_ns.load()) / count / 1000 : 0.0) << " us, ";
+    }
+};
+
+/**
+ * @brief 회수 방식 공통 인터페이스
+ * enter/leave: 공유 노드를 읽는 구간, protect: src가 가리키는 노드를 slot으로 보호하며 읽기,
+ * retire: 구조에서 떼어낸 노드를 안전해지면 해제하도록 맡기기 (enter/leave 구간 안에서). 모두 스레드 번호(tid)를 받는다.
+ */
+template<typename Reclaimer>
+concept Reclamation_Scheme = requires(Reclaimer r, int tid, std::atomic<Reclaim_Node*>& src, Reclaim_Node* node) {
+    r.enter(tid);
+    r.leave(tid);
+    { r.protect(tid, 0, src) } -> std::same_as<Reclaim_Node*>;
+    r.retire(tid, node);
+};
+
+/**
+ * @brief 1. 회수하지 않음 (비교 기준: 모든 retire 노드를 소멸 시 해제)
+ */
+class No_Reclamation {
+    struct alignas(64) Thread_State {
+        vector<Reclaim_Node*> retired;
+        int unflushed = 0;
+    };
+    vector<Thread_State> threads;
+public:
+    Reclaim_Stats stats;
+
+    explicit No_Reclamation(int num_threads) : threads(num_threads) {}
+    ~No_Reclamation() {
+        for (auto& state : threads) {
+            for (Reclaim_Node* node : state.retired) {
+                delete node;
+            }
+        }
+    }
+
+    void enter(int) {}
+    void leave(int) {}
+    Reclaim_Node* protect(int, int, std::atomic<Reclaim_Node*>& src) { return src.load(); }
+    void retire(int tid, Reclaim_Node* node) {
+        Thread_State& state = threads[tid];
+        state.retired.push_back(node);
+        if (++state.unflushed == RECLAIM_STATS_FLUSH) {
+            stats.add_retired(state.unflushed);
+            state.unflushed = 0;
+        }
+    }
+};
+
+/**
+ * @brief 2. Hazard Pointers (Michael, 2004)
+ * 읽으려는 노드를 스레드별 hazard 슬롯에 게시한 뒤 원본이 그대로인지 확인한다.
+ * retire 목록이 일정 크기를 넘으면 모든 hazard를 모아, 아무도 게시하지 않은 노드만 해제한다.
+ */
+class Hazard_Pointers {
+    static constexpr int SLOTS_PER_THREAD = 2;
+
+    struct alignas(64) Thread_State {
+        std::atomic<Reclaim_Node*> hazards[SLOTS_PER_THREAD] = {};
+        vector<Reclaim_Node*> retired;
+        vector<Reclaim_Node*> to_free;
+        int unflushed = 0;
+    };
+
+    vector<Thread_State> threads;
+    size_t scan_threshold;
+
+    void scan(Thread_State& state) {
+        vector<Reclaim_Node*> hazards;
+        for (auto& other : threads) {
+            for (auto& hazard : other.hazards) {
+                if (Reclaim_Node* node = hazard.load()) {
+                    hazards.push_back(node);
+                }
+            }
+        }
+        sort(hazards.begin(), hazards.end());
+
+        vector<Reclaim_Node*> still_hazardous;
+        for (Reclaim_Node* node : state.retired) {
+            if (binary_search(hazards.begin(), hazards.end(), node)) {
+                still_hazardous.push_back(node);
+            } else {
+                state.to_free.push_back(node);
+            }
+        }
+        state.retired.swap(still_hazardous);
+        stats.free_nodes(state.to_free);
+    }
+
+public:
+    Reclaim_Stats stats;
+
+    explicit Hazard_Pointers(int num_threads)
+        : threads(num_threads), scan_threshold(max(64, 2 * SLOTS_PER_THREAD * num_threads)) {}
+    ~Hazard_Pointers() {
+        for (auto& state : threads) {
+            for (Reclaim_Node* node : state.retired) {
+                delete node;
+            }
+        }
+    }
+
+    void enter(int) {}
+    void leave(int tid) {
+        for (auto& hazard : threads[tid].hazards) {
+            hazard.store(nullptr);
+        }
+    }
+    Reclaim_Node* protect(int tid, int slot, std::atomic<Reclaim_Node*>& src) {
+        Reclaim_Node* node = src.load();
+        while (true) {
+            threads[tid].hazards[slot].store(node);
+            Reclaim_Node* again = src.load();
+            if (again == node) {
+                return node;
+            }
+            node = again;
+        }
+    }
+    void retire(int tid, Reclaim_Node* node) {
+        Thread_State& state = threads[tid];
+        node->retired_at = timer_now();
+        state.retired.push_back(node);
+        if (++state.unflushed == RECLAIM_STATS_FLUSH) {
+            stats.add_retired(state.unflushed);
+            state.unflushed = 0;
+        }
+        if (state.retired.size() >= scan_threshold) {
+            scan(state);
+        }
+    }
+};
+
+/**
+ * @brief 3. Epoch-Based Reclamation (Fraser, 2004)
+ * 스레드는 enter 때 전역 epoch를 자기 슬롯에 기록한다. 활동 중인 모든 스레드가 현재 epoch에
+ * 들어와 있으면 전역 epoch를 하나 올린다. 노드는 retire 시점(임계 구역 안)에 읽은 전역 epoch e로
+ * 표시되며, 전역 epoch가 e + 2 이상이 되면 e 이하에 들어온 스레드가 모두 빠져나갔으므로 해제한다.
+ * (진입 시점의 epoch로 표시하면, 그 사이 전역 epoch가 올라 뒤늦게 들어온 스레드가 참조 중인 노드를 일찍 해제할 수 있다.)
+ */
+class Epoch_Reclamation {
+    static constexpr uint64_t ACTIVE = 1;         // 슬롯 값 = (epoch << 1) | ACTIVE
+    static constexpr int ADVANCE_INTERVAL = 64;   // retire 이만큼마다 epoch 전진 시도
+
+    struct Limbo_Bag {
+        uint64_t epoch = 0; // 담긴 노드들의 retire epoch
+        vector<Reclaim_Node*> nodes;
+    };
+
+    struct alignas(64) Thread_State {
+        std::atomic<uint64_t> slot = 0;
+        uint64_t observed_epoch = 0;
+        Limbo_Bag limbo[3]; // retire epoch % 3 번 목록
+        int retires_since_advance = 0;
+        int unflushed = 0;
+    };
+
+    alignas(64) std::atomic<uint64_t> global_epoch = 0;
+    vector<Thread_State> threads;
+
+    void try_advance() {
+        uint64_t epoch = global_epoch.load();
+        for (auto& other : threads) {
+            uint64_t slot = other.slot.load();
+            if ((slot & ACTIVE) && (slot >> 1) != epoch) {
+                return;
+            }
+        }
+        global_epoch.compare_exchange_strong(epoch, epoch + 1);
+    }
+
+public:
+    Reclaim_Stats stats;
+
+    explicit Epoch_Reclamation(int num_threads) : threads(num_threads) {}
+    ~Epoch_Reclamation() {
+        for (auto& state : threads) {
+            for (auto& bag : state.limbo) {
+                for (Reclaim_Node* node : bag.nodes) {
+                    delete node;
+                }
+            }
+        }
+    }
+
+    void enter(int tid) {
+        Thread_State& state = threads[tid];
+        uint64_t epoch = global_epoch.load();
+        state.slot.store((epoch << 1) | ACTIVE);
+        if (epoch != state.observed_epoch) {
+            state.observed_epoch = epoch;
+            for (auto& bag : state.limbo) {
+                if (!bag.nodes.empty() && bag.epoch + 2 <= epoch) {
+                    stats.free_nodes(bag.nodes);
+                }
+            }
+        }
+    }
+    void leave(int tid) {
+        threads[tid].slot.store(threads[tid].slot.load() & ~ACTIVE);
+    }
+    Reclaim_Node* protect(int, int, std::atomic<Reclaim_Node*>& src) { return src.load(); }
+    // 임계 구역 안(leave 전)에서 불러야 한다
+    void retire(int tid, Reclaim_Node* node) {
+        Thread_State& state = threads[tid];
+        uint64_t epoch = global_epoch.load();
+        Limbo_Bag& bag = state.limbo[epoch % 3];
+        if (bag.epoch != epoch) {
+            // 같은 칸의 이전 노드들은 epoch - 3 이하에 retire됐으므로 이미 안전하다
+            stats.free_nodes(bag.nodes);
+            bag.epoch = epoch;
+        }
+        node->retired_at = timer_now();
+        bag.nodes.push_back(node);
+        if (++state.unflushed == RECLAIM_STATS_FLUSH) {
+            stats.add_retired(state.unflushed);
+            state.unflushed = 0;
+        }
+        if (++state.retires_since_advance == ADVANCE_INTERVAL) {
+            state.retires_since_advance = 0;
+            try_advance();
+        }
+    }
+};
+
+
+// =================================================
+
+/**
+ * @brief 스레드별 진행 카운터 (샘플러가 읽는다, false sharing 방지용 패딩)
+ */
+struct alignas(64) Progress_Slot {
+    std::atomic<long long> ops = 0;
+};
+
+/**
+ * @brief 처리량 시계열 샘플러
+ * interval_ms마다 모든 스레드의 진행 카운터 합을 읽어 구간 처리량(ops/s)을 기록한다.
+ * interval_ms가 0이면 스레드를 띄우지 않는다.
+ */
+class Throughput_Sampler {
+    vector<Progress_Slot>& progress;
+    int interval_ms;
+    std::atomic<bool> stopping = false;
+    vector<double> series; // 구간별 ops/s
+    thread sampler;
+
+    long long total_ops() const {
+        long long total = 0;
+        for (const auto& slot : progress) {
+            total += slot.ops.load(std::memory_order_relaxed);
+        }
+        return total;
+    }
+
+    void sample_loop() {
+        uint64_t last_time = timer_now();
+        long long last_ops = total_ops();
+        while (!stopping.load()) {
+            this_thread::sleep_for(chrono::milliseconds(interval_ms));
+            if (stopping.load()) {
+                break; // 실행이 끝난 뒤의 부분 구간은 버린다
+            }
+            uint64_t now = timer_now();
+            long long ops = total_ops();
+            long long elapsed_ns = timer_elapsed_ns(last_time, now);
+            if (elapsed_ns > 0) {
+                series.push_back((ops - last_ops) * 1e9 / elapsed_ns);
+            }
+            last_time = now;
+            last_ops = ops;
+        }
+    }
+
+public:
+    Throughput_Sampler(vector<Progress_Slot>& progress, int interval_ms) : progress(progress), interval_ms(interval_ms) {
+        if (interval_ms > 0) {
+            sampler = thread(&Throughput_Sampler::sample_loop, this);
+        }
+    }
+    ~Throughput_Sampler() {
+        stop();
+    }
+
+    bool enabled() const { return interval_ms > 0; }
+
+    void stop() {
+        stopping.store(true);
+        if (sampler.joinable()) {
+            sampler.join();
+        }
+    }
+
+    /**
+     * @brief 시계열 출력 (Mops/s) 및 최소/최대 구간 처리량
+     */
+    void print() const {
+        if (!enabled()) {
+            return;
+        }
+        cout << "    Throughput Series (Mops/s, every " << interval_ms << " ms): [";
+        for (size_t i = 0; i < series.size(); ++i) {
+            cout << (i ? ", " : "") << series[i] / 1e6;
+        }
+        cout << "]";
+        if (!series.empty()) {
+            auto [low, high] = minmax_element(series.begin(), series.end());
+            cout << ", min/max = " << *low / 1e6 << "/" << *high / 1e6;
+        }
+        cout << endl;
+    }
+};
+
+/**
+ * @brief perf_event 카운터 (열 수 없으면 valid()가 false)
+ * cpu < 0이면 inherit 모드로 열어 이후 생성되어 종료된 스레드의 카운트까지 합산하고,
+ * cpu >= 0이면 그 CPU 전체를 센다 (msr PMU처럼 태스크 단위 측정을 지원하지 않는 PMU용).
+ */
+class Perf_Counter {
+    int fd = -1;
+public:
+    Perf_Counter(uint32_t type, uint64_t config, int cpu = -1) {
+        perf_event_attr attr{};
+        attr.size = sizeof(attr);
+        attr.type = type;
+        attr.config = config;
+        if (cpu < 0) {
+            attr.inherit = 1;
+            attr.exclude_kernel = 1;
+            attr.exclude_hv = 1;
+        }
+        fd = syscall(SYS_perf_event_open, &attr, cpu < 0 ? 0 : -1, cpu, -1, 0);
+    }
+    ~Perf_Counter() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    Perf_Counter(const Perf_Counter&) = delete;
+    Perf_Counter& operator=(const Perf_Counter&) = delete;
+
+    bool valid() const { return fd >= 0; }
+
+    long long read_value() const {
+        long long value = 0;
+        if (fd < 0 || read(fd, &value, sizeof(value)) != sizeof(value)) {
+            return -1;
+        }
+        return value;
+    }
+};
+
+/**
+ * @brief perf msr PMU의 이벤트 번호 조회 (/sys/bus/event_source/devices/msr)
+ * @return PMU나 이벤트가 없으면 false
+ */
+bool perf_msr_event(const char* name, uint32_t& type, uint64_t& config) {
+    char path[128];
+    FILE* file = fopen("/sys/bus/event_source/devices/msr/type", "r");
+    if (file == nullptr) {
+        return false;
+    }
+    bool ok = fscanf(file, "%u", &type) == 1;
+    fclose(file);
+    snprintf(path, sizeof(path), "/sys/bus/event_source/devices/msr/events/%s", name);
+    if (!ok || (file = fopen(path, "r")) == nullptr) {
+        return false;
+    }
+    unsigned long value;
+    ok = fscanf(file, "event=%lx", &value) == 1;
+    fclose(file);
+    config = value;
+    return ok;
+}
+
+/**
+ * @brief 실행 구간의 실효 CPU 주파수 측정기
+ * 가능한 첫 번째 방법을 쓴다: perf msr PMU의 APERF/MPERF -> /dev/cpu/N/msr의 APERF/MPERF
+ * -> /sys cpufreq scaling_cur_freq -> /proc/cpuinfo "cpu MHz".
+ * APERF/MPERF는 CPU가 깨어 있는(C0) 동안만 세므로 전체 CPU 합의 비율에 공칭 주파수(보정된 TSC 주파수)를
+ * 곱하면 바쁜 CPU의 실효 주파수가 된다. cpufreq/cpuinfo는 순간값이므로 실행 중 SAMPLE_INTERVAL_MS마다
+ * 표본을 뜨고, 직전 구간에 각 CPU가 바빴던 시간(/proc/stat)으로 가중 평균한다. 실행 중 표본이 없으면 측정 불가다.
+ */
+class Frequency_Meter {
+    static constexpr uint32_t MSR_MPERF = 0xE7;
+    static constexpr uint32_t MSR_APERF = 0xE8;
+    static constexpr int SAMPLE_INTERVAL_MS = 20;
+
+    const char* source = "n/a";
+    int num_cpus = max(1, get_nprocs_conf());
+    vector<unique_ptr<Perf_Counter>> aperf_counters, mperf_counters;
+    vector<int> msr_fds;
+    long long start_aperf = 0, start_mperf = 0;
+
+    std::atomic<bool> stopping = false;
+    vector<long long> last_busy; // CPU별 누적 사용 시간 (jiffies)
+    double weighted_mhz = 0;     // sum(주파수 * 사용 시간)
+    double busy_weight = 0;      // sum(사용 시간)
+    thread sampler;
+
+    bool read_msr_sums(long long& aperf, long long& mperf) const {
+        aperf = mperf = 0;
+        for (int fd : msr_fds) {
+            uint64_t a, m;
+            if (pread(fd, &a, sizeof(a), MSR_APERF) != sizeof(a) || pread(fd, &m, sizeof(m), MSR_MPERF) != sizeof(m)) {
+                return false;
+            }
+            aperf += a;
+            mperf += m;
+        }
+        return true;
+    }
+
+    void read_perf_sums(long long& aperf, long long& mperf) const {
+        aperf = mperf = 0;
+        for (int cpu = 0; cpu < num_cpus; ++cpu) {
+            aperf += aperf_counters[cpu]->read_value();
+            mperf += mperf_counters[cpu]->read_value();
+        }
+    }
+
+    // CPU별 현재 주파수 (MHz), 읽을 수 없는 CPU는 0
+    vector<double> read_cpu_mhz() const {
+        vector<double> mhz(num_cpus, 0);
+        if (strcmp(source, "cpufreq") == 0) {
+            for (int cpu = 0; cpu < num_cpus; ++cpu) {
+                char path[96];
+                snprintf(path, sizeof(path), "/sys/devices/system/cpu/cpu%d/cpufreq/scaling_cur_freq", cpu);
+                if (FILE* file = fopen(path, "r")) {
+                    long khz;
+                    if (fscanf(file, "%ld", &khz) == 1) {
+                        mhz[cpu] = khz / 1000.0;
+                    }
+                    fclose(file);
+                }
+            }
+        } else if (FILE* file = fopen("/proc/cpuinfo", "r")) {
+            char line[256];
+            int cpu = -1;
+            double value;
+            while (fgets(line, sizeof(line), file)) {
+                if (sscanf(line, "processor : %d", &cpu) != 1 && sscanf(line, "cpu MHz : %lf", &value) == 1 && cpu >= 0 && cpu < num_cpus) {
+                    mhz[cpu] = value;
+                }
+            }
+            fclose(file);
+        }
+        return mhz;
+    }
+
+    // CPU별 누적 사용 시간 (user + nice + system + irq + softirq jiffies)
+    bool read_busy_times(vector<long long>& busy) const {
+        FILE* file = fopen("/proc/stat", "r");
+        if (file == nullptr) {
+            return false;
+        }
+        busy.assign(num_cpus, 0);
+        bool found = false;
+        char line[512];
+        while (fgets(line, sizeof(line), file)) {
+            int cpu;
+            long long user, nice, system, idle, iowait, irq, softirq;
+            if (sscanf(line, "cpu%d %lld %lld %lld %lld %lld %lld %lld", &cpu, &user, &nice, &system, &idle, &iowait, &irq, &softirq) == 8
+                && cpu >= 0 && cpu < num_cpus) {
+                busy[cpu] = user + nice + system + irq + softirq;
+                found = true;
+            }
+        }
+        fclose(file);
+        return found;
+    }
+
+    // 직전 표본 이후 바빴던 CPU의 주파수를 그 사용 시간으로 가중해 누적한다
+    void take_sample() {
+        vector<long long> busy;
+        if (!read_busy_times(busy)) {
+            return;
+        }
+        vector<double> mhz = read_cpu_mhz();
+        for (int cpu = 0; cpu < num_cpus; ++cpu) {
+            long long delta = busy[cpu] - last_busy[cpu];
+            if (delta > 0 && mhz[cpu] > 0) {
+                weighted_mhz += mhz[cpu] * delta;
+                busy_weight += delta;
+            }
+        }
+        last_busy.swap(busy);
+    }
+
+    void sample_loop() {
+        while (!stopping.load()) {
+            this_thread::sleep_for(chrono::milliseconds(SAMPLE_INTERVAL_MS));
+            take_sample();
+        }
+    }
+
+    static double nominal_ghz() {
+        const Timer_Calibration& calibration = timer_calibration();
+        return calibration.use_tsc ? 1.0 / calibration.ns_per_tick : 0;
+    }
+
+public:
+    Frequency_Meter() {
+        uint32_t type;
+        uint64_t aperf_config, mperf_config;
+        if (nominal_ghz() > 0 && perf_msr_event("aperf", type, aperf_config) && perf_msr_event("mperf", type, mperf_config)) {
+            bool all_valid = true;
+            for (int cpu = 0; cpu < num_cpus && all_valid; ++cpu) {
+                aperf_counters.push_back(make_unique<Perf_Counter>(type, aperf_config, cpu));
+                mperf_counters.push_back(make_unique<Perf_Counter>(type, mperf_config, cpu));
+                all_valid = aperf_counters.back()->valid() && mperf_counters.back()->valid();
+            }
+            if (all_valid) {
+                source = "APERF/MPERF perf";
+                read_perf_sums(start_aperf, start_mperf);
+                return;
+            }
+            aperf_counters.clear();
+            mperf_counters.clear();
+        }
+
+        if (nominal_ghz() > 0) {
+            for (int cpu = 0; cpu < num_cpus; ++cpu) {
+                char path[64];
+                snprintf(path, sizeof(path), "/dev/cpu/%d/msr", cpu);
+                int fd = open(path, O_RDONLY);
+                if (fd < 0) {
+                    break;
+                }
+                msr_fds.push_back(fd);
+            }
+            if (int(msr_fds.size()) == num_cpus && read_msr_sums(start_aperf, start_mperf)) {
+                source = "APERF/MPERF msr";
+                return;
+            }
+            for (int fd : msr_fds) {
+                close(fd);
+            }
+            msr_fds.clear();
+        }
+
+        for (const char* name : {"cpufreq", "cpuinfo"}) {
+            source = name;
+            vector<double> mhz = read_cpu_mhz();
+            if (any_of(mhz.begin(), mhz.end(), [](double value) { return value > 0; }) && read_busy_times(last_busy)) {
+                sampler = thread(&Frequency_Meter::sample_loop, this);
+                return;
+            }
+        }
+        source = "n/a";
+    }
+    ~Frequency_Meter() {
+        stopping.store(true);
+        if (sampler.joinable()) {
+            sampler.join();
+        }
+        for (int fd : msr_fds) {
+            close(fd);
+        }
+    }
+    Frequency_Meter(const Frequency_Meter&) = delete;
+    Frequency_Meter& operator=(const Frequency_Meter&) = delete;
+
+    const char* source_name() const { return source; }
+
+    /**
+     * @brief 생성 이후 구간의 실효 주파수 (GHz), 측정할 수 없으면 0
+     */
+    double stop() {
+        long long aperf, mperf;
+        if (!aperf_counters.empty()) {
+            read_perf_sums(aperf, mperf);
+        } else if (!msr_fds.empty()) {
+            if (!read_msr_sums(aperf, mperf)) {
+                return 0;
+            }
+        } else if (sampler.joinable()) {
+            stopping.store(true);
+            sampler.join();
+            take_sample(); // 마지막 부분 구간
+            return busy_weight > 0 ? weighted_mhz / busy_weight / 1000 : 0;
+        } else {
+            return 0;
+        }
+        long long delta_mperf = mperf - start_mperf;
+        return delta_mperf > 0 ? nominal_ghz() * double(aperf - start_aperf) / delta_mperf : 0;
+    }
+};
+
+/**
+ * @brief 스레드 작업 함수 (Lock 사용)
+ * @param start_val 스레드가 합산할 시작 숫자
+ * @param end_val 스레드가 합산할 종료 숫자
+ * @param progress 샘플링 중이면 진행 카운터, 아니면 nullptr
+ * @param cpu 첫 연산 전에 고정할 CPU (-1이면 고정하지 않음)
+ */
+template<typename LockType>
+void worker_function_with_lock(LockType& lock_instance, long long& counter, int start_val, int end_val, Progress_Slot* progress, int cpu) {
+    if (cpu >= 0 && !pin_thread_to_cpu(cpu)) {
+        ++g_pin_failures;
+    }
+    for (int i = start_val; i <= end_val; ++i) {
+        lock_instance.lock();
+        counter += i; // Critical Section: 실제 숫자를 공유 카운터에 더함
+        lock_instance.unlock();
+        if (progress != nullptr) {
+            progress->ops.store(i - start_val + 1, std::memory_order_relaxed);
+        }
+    }
+}
+
+/**
+ * @brief 스레드 작업 함수 (No Lock 사용)
+ * @param start_val 스레드가 합산할 시작 숫자
+ * @param end_val 스레드가 합산할 종료 숫자
+ * @param progress 샘플링 중이면 진행 카운터, 아니면 nullptr
+ * @param cpu 첫 연산 전에 고정할 CPU (-1이면 고정하지 않음)
+ */
+void worker_function_no_lock(long long& counter, int start_val, int end_val, Progress_Slot* progress, int cpu) {
+    if (cpu >= 0 && !pin_thread_to_cpu(cpu)) {
+        ++g_pin_failures;
+    }
+    for (int i = start_val; i <= end_val; ++i) {
+        counter += i; // Critical Section: 실제 숫자를 공유 카운터에 더함
+        if (progress != nullptr) {
+            progress->ops.store(i - start_val + 1, std::memory_order_relaxed);
+        }
+    }
+}
+
+
+/**
+ * @brief 실험 실행 및 결과 측정
+ */
+template<typename LockType>
+double run_experiment(const string& lock_name, int num_threads, bool use_lock = true) {
+    
+    // 초기화
+    shared_counter = 0;
+    LockType lock_instance;
+    
+    // [**1. 정답 계산 (가우스 공식)**]
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+
+    // [**2. 작업 범위 분배**] (--sample-ms=N 이면 N ms마다 처리량 샘플링)
+    vector<Progress_Slot> progress(num_threads);
+    Throughput_Sampler sampler(progress, option_value("sample-ms", 0));
+    g_pin_failures = 0;
+    Frequency_Meter frequency;
+    vector<thread> threads;
+    auto start_time = timer_now();
+    
+    int current_start = START_NUM;
+    
+    for (int i = 0; i < num_threads; ++i) {
+        // 각 스레드가 처리할 숫자의 개수
+        int range_size = NUM_OPERATIONS / num_threads + (i < NUM_OPERATIONS % num_threads ? 1 : 0);
+        int current_end = current_start + range_size - 1;
+
+        if (current_end > END_NUM) { 
+            current_end = END_NUM;
+        }
+
+        int cpu = g_pinned_cpus.empty() ? -1 : g_pinned_cpus[i % g_pinned_cpus.size()];
+        if (use_lock) {
+            // 락을 사용하는 경우
+            threads.emplace_back(worker_function_with_lock<LockType>, ref(lock_instance), ref(shared_counter), current_start, current_end,
+                                 sampler.enabled() ? &progress[i] : nullptr, cpu);
+        } else {
+            // No Lock (락을 사용하지 않는 경우)
+            threads.emplace_back(worker_function_no_lock, ref(shared_counter), current_start, current_end,
+                                 sampler.enabled() ? &progress[i] : nullptr, cpu);
+        }
+
+        current_start = current_end + 1;
+    }
+
+    // 모든 스레드 종료 대기
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+    sampler.stop();
+    double effective_ghz = frequency.stop();
+    
+    // 결과 출력
+    cout << lock_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    if (effective_ghz > 0) {
+        // 주파수로 정규화한 연산당 사이클 (터보/스로틀링에 따른 시간 차이를 걸러 낸다)
+        cout << "Freq = " << effective_ghz << " GHz (" << frequency.source_name() << "), ";
+        cout << "Cycles/Op = " << effective_ghz * duration.count() * 1e9 / NUM_OPERATIONS << ", ";
+    } else {
+        cout << "Freq = n/a, ";
+    }
+    
+    // [**3. 정확성 검증**]
+    bool is_correct = (shared_counter == expected_result);
+    
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+    sampler.print();
+    if (g_pin_failures > 0) {
+        cout << "    Warning: " << g_pin_failures << " of " << num_threads << " threads could not be pinned (--pin)" << endl;
+    }
+
+    return duration.count();
+}
+
+
+// ========= [3] 스택 워크로드 (Treiber / Elimination / Lock) =========
+
+constexpr int STACK_OPERATIONS = 2'000'000; // 총 push/pop 연산 횟수
+
+/**
+ * @brief Lock-free Treiber Stack 구현 (회수 방식을 템플릿으로 받는다)
+ * pop할 노드를 보호한 채 CAS하고, 떼어낸 노드는 Reclaimer에 retire해 아무도 참조하지 않게 되면 해제한다.
+ * 보호 중인 노드는 해제·재사용되지 않으므로 ABA 문제도 생기지 않는다.
+ */
+template<Reclamation_Scheme Reclaimer>
+class Treiber_Stack {
+protected:
+    alignas(64) std::atomic<Reclaim_Node*> top = nullptr;
+    Reclaimer reclaimer;
+
+    bool try_push(Reclaim_Node* node) {
+        Reclaim_Node* old_top = top.load();
+        node->next.store(old_top, std::memory_order_relaxed);
+        return top.compare_exchange_weak(old_top, node);
+    }
+
+    // 반환값: 1 = 성공, 0 = CAS 경합 실패, -1 = 비어 있음
+    int try_pop(int tid, long long& value) {
+        reclaimer.enter(tid);
+        Reclaim_Node* old_top = reclaimer.protect(tid, 0, top);
+        if (old_top == nullptr) {
+            reclaimer.leave(tid);
+            return -1;
+        }
+        if (!top.compare_exchange_weak(old_top, old_top->next.load())) {
+            reclaimer.leave(tid);
+            return 0;
+        }
+        value = old_top->value;
+        reclaimer.retire(tid, old_top);
+        reclaimer.leave(tid);
+        return 1;
+    }
+
+public:
+    explicit Treiber_Stack(int num_threads) : reclaimer(num_threads) {}
+    ~Treiber_Stack() {
+        for (Reclaim_Node* n = top.load(); n != nullptr;) {
+            Reclaim_Node* next = n->next.load();
+            delete n;
+            n = next;
+        }
+    }
+
+    const Reclaim_Stats& stats() const { return reclaimer.stats; }
+
+    void push(int, long long value) {
+        Reclaim_Node* node = new Reclaim_Node{value};
+        while (!try_push(node));
+    }
+
+    bool pop(int tid, long long& value) {
+        int result;
+        while ((result = try_pop(tid, value)) == 0);
+        return result == 1;
+    }
+};
+
+/**
+ * @brief Elimination Array 구현
+ * push 스레드가 슬롯에 노드를 올려두고 잠시 기다리면,
+ * 같은 슬롯을 방문한 pop 스레드가 그 노드를 가져가 스택을 거치지 않고 연산을 상쇄한다.
+ */
+class Elimination_Array {
+    static constexpr int NUM_SLOTS = 8;
+    static constexpr int WAIT_SPINS = 256;
+
+    struct alignas(64) Slot {
+        std::atomic<Reclaim_Node*> item = nullptr;
+    };
+    Slot slots[NUM_SLOTS];
+
+    // pop 스레드가 가져갔음을 표시하는 센티널
+    static Reclaim_Node* taken() {
+        return reinterpret_cast<Reclaim_Node*>(uintptr_t(1));
+    }
+
+    static int random_slot() {
+        thread_local std::minstd_rand rng(std::random_device{}());
+        return rng() % NUM_SLOTS;
+    }
+
+public:
+    /**
+     * @return 상대 pop과 교환에 성공하면 true
+     */
+    bool try_push(Reclaim_Node* node) {
+        Slot& slot = slots[random_slot()];
+        Reclaim_Node* expected = nullptr;
+        if (!slot.item.compare_exchange_strong(expected, node)) {
+            return false;
+        }
+        for (int i = 0; i < WAIT_SPINS; ++i) {
+            if (slot.item.load() == taken()) {
+                slot.item.store(nullptr);
+                return true;
+            }
+        }
+        // 시간 초과: 노드를 회수한다. 실패했다면 그 사이 pop이 가져간 것이다.
+        expected = node;
+        if (slot.item.compare_exchange_strong(expected, nullptr)) {
+            return false;
+        }
+        slot.item.store(nullptr);
+        return true;
+    }
+
+    /**
+     * @return 교환에 성공하면 push 스레드가 올려둔 노드, 아니면 nullptr
+     */
+    Reclaim_Node* try_pop() {
+        Slot& slot = slots[random_slot()];
+        Reclaim_Node* item = slot.item.load();
+        if (item == nullptr || item == taken()) {
+            return nullptr;
+        }
+        return slot.item.compare_exchange_strong(item, taken()) ? item : nullptr;
+    }
+};
+
+/**
+ * @brief Elimination-Backoff Stack 구현
+ * Treiber Stack의 CAS가 경합으로 실패하면 backoff 대신 Elimination Array에서
+ * 반대 연산과의 교환을 시도한다.
+ */
+template<Reclamation_Scheme Reclaimer>
+class Elimination_Stack : public Treiber_Stack<Reclaimer> {
+    Elimination_Array elimination;
+public:
+    using Treiber_Stack<Reclaimer>::Treiber_Stack;
+
+    void push(int, long long value) {
+        Reclaim_Node* node = new Reclaim_Node{value};
+        while (true) {
+            if (this->try_push(node)) {
+                return;
+            }
+            if (elimination.try_push(node)) {
+                return;
+            }
+        }
+    }
+
+    bool pop(int tid, long long& value) {
+        while (true) {
+            int result = this->try_pop(tid, value);
+            if (result != 0) {
+                return result == 1;
+            }
+            Reclaim_Node* node = elimination.try_pop();
+            if (node != nullptr) {
+                // 교환된 노드는 스택에 실린 적이 없어 다른 스레드가 참조하지 않으므로 바로 해제한다
+                value = node->value;
+                delete node;
+                return true;
+            }
+        }
+    }
+};
+
+/**
+ * @brief LockType으로 보호되는 스택 구현
+ */
+template<typename LockType>
+class Locked_Stack {
+    LockType lock_instance;
+    Reclaim_Node* top = nullptr;
+public:
+    explicit Locked_Stack(int) {}
+    ~Locked_Stack() {
+        while (top != nullptr) {
+            Reclaim_Node* next = top->next.load(std::memory_order_relaxed);
+            delete top;
+            top = next;
+        }
+    }
+
+    void push(int, long long value) {
+        Reclaim_Node* node = new Reclaim_Node{value};
+        lock_instance.lock();
+        node->next.store(top, std::memory_order_relaxed);
+        top = node;
+        lock_instance.unlock();
+    }
+
+    bool pop(int, long long& value) {
+        lock_instance.lock();
+        Reclaim_Node* node = top;
+        if (node != nullptr) {
+            top = node->next.load(std::memory_order_relaxed);
+        }
+        lock_instance.unlock();
+        if (node == nullptr) {
+            return false;
+        }
+        value = node->value;
+        delete node;
+        return true;
+    }
+};
+
+struct Stack_Thread_Result {
+    long long pushed_sum = 0;
+    long long popped_sum = 0;
+    long long empty_pops = 0;
+};
+
+/**
+ * @brief 스택 스레드 작업 함수 (push/pop 혼합)
+ * @param num_ops 스레드가 수행할 연산 횟수
+ * @param push_percent push 연산의 비율 (%)
+ */
+template<typename StackType>
+void stack_worker_function(StackType& stack, int tid, int num_ops, int push_percent, Stack_Thread_Result& result) {
+    std::minstd_rand rng(tid + 1);
+    Stack_Thread_Result local;
+    for (int i = 0; i < num_ops; ++i) {
+        if (int(rng() % 100) < push_percent) {
+            stack.push(tid, i);
+            local.pushed_sum += i;
+        } else {
+            long long value;
+            if (stack.pop(tid, value)) {
+                local.popped_sum += value;
+            } else {
+                ++local.empty_pops;
+            }
+        }
+    }
+    result = local;
+}
+
+/**
+ * @brief 스택 실험 실행 및 결과 측정
+ */
+template<typename StackType>
+double run_stack_experiment(const string& stack_name, int num_threads, int push_percent) {
+
+    StackType stack(num_threads);
+    vector<Stack_Thread_Result> results(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = STACK_OPERATIONS / num_threads + (i < STACK_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(stack_worker_function<StackType>, ref(stack), i, num_ops, push_percent, ref(results[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] push된 값의 합 = pop된 값의 합 + 스택에 남은 값의 합
+    long long pushed_sum = 0, popped_sum = 0, empty_pops = 0;
+    for (const auto& r : results) {
+        pushed_sum += r.pushed_sum;
+        popped_sum += r.popped_sum;
+        empty_pops += r.empty_pops;
+    }
+    long long remaining_sum = 0;
+    long long value;
+    while (stack.pop(0, value)) {
+        remaining_sum += value;
+    }
+
+    cout << stack_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << STACK_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    cout << "Empty Pops = " << empty_pops;
+
+    bool is_correct = (pushed_sum == popped_sum + remaining_sum);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(pushed_sum - popped_sum - remaining_sum);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [4] 정렬 집합 워크로드 (Skip List) =========
+
+constexpr int SET_OPERATIONS = 2'000'000; // 총 집합 연산 횟수
+constexpr int SKIP_LIST_MAX_LEVEL = 20;
+
+/**
+ * @brief Skip List 노드의 레벨을 기하 분포(p = 1/2)로 선택
+ */
+int random_skip_list_level() {
+    thread_local std::minstd_rand rng(std::random_device{}());
+    return __builtin_ctz(unsigned(rng()) | (1u << SKIP_LIST_MAX_LEVEL));
+}
+
+/**
+ * @brief Lazy Synchronization Skip List 구현
+ * 탐색은 락 없이 진행하고, 수정할 때만 선행 노드들의 LockType 락을 잡은 뒤
+ * (marked / next 포인터) 검증에 성공하면 반영한다. (Herlihy & Shavit, 14.3)
+ */
+template<typename LockType>
+class Lazy_Skip_List {
+    struct Node {
+        int key;
+        int top_level;
+        std::atomic<Node*> next[SKIP_LIST_MAX_LEVEL + 1] = {};
+        std::atomic<bool> marked = false;
+        std::atomic<bool> fully_linked = false;
+        LockType lock;
+        Node* retired_next = nullptr;
+
+        Node(int key, int top_level) : key(key), top_level(top_level) {}
+
+        static void* operator new(size_t size) { return g_node_pool.allocate(size); }
+        static void operator delete(void* pointer, size_t size) { g_node_pool.deallocate(pointer, size); }
+    };
+
+    Node head{INT32_MIN, SKIP_LIST_MAX_LEVEL};
+    Node tail{INT32_MAX, SKIP_LIST_MAX_LEVEL};
+    std::atomic<Node*> retired = nullptr;
+
+    int find(int key, Node* preds[], Node* succs[]) {
+        int found_level = -1;
+        Node* pred = &head;
+        for (int level = SKIP_LIST_MAX_LEVEL; level >= 0; --level) {
+            Node* curr = pred->next[level].load();
+            while (key > curr->key) {
+                pred = curr;
+                curr = pred->next[level].load();
+            }
+            if (found_level == -1 && key == curr->key) {
+                found_level = level;
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return found_level;
+    }
+
+    // 같은 노드가 여러 레벨의 선행 노드일 수 있으므로 노드마다 한 번만 락을 잡고 푼다
+    static void unlock_preds(Node* preds[], int highest_locked) {
+        for (int level = 0; level <= highest_locked; ++level) {
+            if (level == 0 || preds[level] != preds[level - 1]) {
+                preds[level]->lock.unlock();
+            }
+        }
+    }
+
+    void retire(Node* node) {
+        Node* old_head = retired.load();
+        do {
+            node->retired_next = old_head;
+        } while (!retired.compare_exchange_weak(old_head, node));
+    }
+
+public:
+    Lazy_Skip_List() {
+        for (int level = 0; level <= SKIP_LIST_MAX_LEVEL; ++level) {
+            head.next[level].store(&tail);
+        }
+        head.fully_linked = tail.fully_linked = true;
+    }
+
+    ~Lazy_Skip_List() {
+        for (Node* n = head.next[0].load(); n != &tail;) {
+            Node* next = n->next[0].load();
+            delete n;
+            n = next;
+        }
+        for (Node* n = retired.load(); n != nullptr;) {
+            Node* next = n->retired_next;
+            delete n;
+            n = next;
+        }
+    }
+
+    bool add(int key) {
+        int top_level = random_skip_list_level();
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        while (true) {
+            int found_level = find(key, preds, succs);
+            if (found_level != -1) {
+                Node* node_found = succs[found_level];
+                if (!node_found->marked.load()) {
+                    while (!node_found->fully_linked.load());
+                    return false;
+                }
+                continue;
+            }
+
+            int highest_locked = -1;
+            bool valid = true;
+            for (int level = 0; valid && level <= top_level; ++level) {
+                Node* pred = preds[level];
+                Node* succ = succs[level];
+                if (level == 0 || pred != preds[level - 1]) {
+                    pred->lock.lock();
+                }
+                highest_locked = level;
+                valid = !pred->marked.load() && !succ->marked.load() && pred->next[level].load() == succ;
+            }
+            if (!valid) {
+                unlock_preds(preds, highest_locked);
+                continue;
+            }
+
+            Node* new_node = new Node(key, top_level);
+            for (int level = 0; level <= top_level; ++level) {
+                new_node->next[level].store(succs[level]);
+            }
+            for (int level = 0; level <= top_level; ++level) {
+                preds[level]->next[level].store(new_node);
+            }
+            new_node->fully_linked.store(true);
+            unlock_preds(preds, highest_locked);
+            return true;
+        }
+    }
+
+    bool remove(int key) {
+        Node* victim = nullptr;
+        bool is_marked = false;
+        int top_level = -1;
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        while (true) {
+            int found_level = find(key, preds, succs);
+            if (found_level != -1) {
+                victim = succs[found_level];
+            }
+            if (!is_marked && (found_level == -1 || !victim->fully_linked.load() || victim->top_level != found_level || victim->marked.load())) {
+                return false;
+            }
+
+            if (!is_marked) {
+                top_level = victim->top_level;
+                victim->lock.lock();
+                if (victim->marked.load()) {
+                    victim->lock.unlock();
+                    return false;
+                }
+                victim->marked.store(true); // 논리적 삭제
+                is_marked = true;
+            }
+
+            int highest_locked = -1;
+            bool valid = true;
+            for (int level = 0; valid && level <= top_level; ++level) {
+                Node* pred = preds[level];
+                if (level == 0 || pred != preds[level - 1]) {
+                    pred->lock.lock();
+                }
+                highest_locked = level;
+                valid = !pred->marked.load() && pred->next[level].load() == victim;
+            }
+            if (!valid) {
+                unlock_preds(preds, highest_locked);
+                continue;
+            }
+
+            // 물리적 삭제
+            for (int level = top_level; level >= 0; --level) {
+                preds[level]->next[level].store(victim->next[level].load());
+            }
+            victim->lock.unlock();
+            unlock_preds(preds, highest_locked);
+            retire(victim);
+            return true;
+        }
+    }
+
+    bool contains(int key) {
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        int found_level = find(key, preds, succs);
+        return found_level != -1 && succs[found_level]->fully_linked.load() && !succs[found_level]->marked.load();
+    }
+
+    /**
+     * @brief [low, high] 구간의 키 개수 (락 없이 바닥 레벨을 순회, 선형화 가능하지 않음)
+     */
+    int range_count(int low, int high) {
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        find(low, preds, succs);
+        int count = 0;
+        for (Node* curr = succs[0]; curr->key <= high && curr != &tail; curr = curr->next[0].load()) {
+            if (curr->fully_linked.load() && !curr->marked.load()) {
+                ++count;
+            }
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief Lock-free Skip List 구현
+ * next 포인터의 최하위 비트를 삭제 표시(mark)로 사용하며,
+ * 탐색 중 표시된 노드를 CAS로 떼어낸다. (Herlihy & Shavit, 14.4)
+ */
+class Lock_Free_Skip_List {
+    struct Node {
+        int key;
+        int top_level;
+        std::atomic<uintptr_t> next[SKIP_LIST_MAX_LEVEL + 1] = {};
+        Node* retired_next = nullptr;
+
+        Node(int key, int top_level) : key(key), top_level(top_level) {}
+
+        static void* operator new(size_t size) { return g_node_pool.allocate(size); }
+        static void operator delete(void* pointer, size_t size) { g_node_pool.deallocate(pointer, size); }
+    };
+
+    static Node* pointer_of(uintptr_t word) { return reinterpret_cast<Node*>(word & ~uintptr_t(1)); }
+    static bool is_marked(uintptr_t word) { return word & 1; }
+    static uintptr_t word_of(Node* node) { return reinterpret_cast<uintptr_t>(node); }
+
+    Node head{INT32_MIN, SKIP_LIST_MAX_LEVEL};
+    Node tail{INT32_MAX, SKIP_LIST_MAX_LEVEL};
+    std::atomic<Node*> retired = nullptr;
+
+    bool find(int key, Node* preds[], Node* succs[]) {
+    retry:
+        Node* pred = &head;
+        for (int level = SKIP_LIST_MAX_LEVEL; level >= 0; --level) {
+            Node* curr = pointer_of(pred->next[level].load());
+            while (true) {
+                uintptr_t succ = curr->next[level].load();
+                while (is_marked(succ)) {
+                    uintptr_t expected = word_of(curr);
+                    if (!pred->next[level].compare_exchange_strong(expected, succ & ~uintptr_t(1))) {
+                        goto retry;
+                    }
+                    curr = pointer_of(succ);
+                    succ = curr->next[level].load();
+                }
+                if (curr->key < key) {
+                    pred = curr;
+                    curr = pointer_of(succ);
+                } else {
+                    break;
+                }
+            }
+            preds[level] = pred;
+            succs[level] = curr;
+        }
+        return succs[0]->key == key;
+    }
+
+    void retire(Node* node) {
+        Node* old_head = retired.load();
+        do {
+            node->retired_next = old_head;
+        } while (!retired.compare_exchange_weak(old_head, node));
+    }
+
+public:
+    Lock_Free_Skip_List() {
+        for (int level = 0; level <= SKIP_LIST_MAX_LEVEL; ++level) {
+            head.next[level].store(word_of(&tail));
+        }
+    }
+
+    ~Lock_Free_Skip_List() {
+        for (Node* n = pointer_of(head.next[0].load()); n != &tail;) {
+            Node* next = pointer_of(n->next[0].load());
+            delete n;
+            n = next;
+        }
+        for (Node* n = retired.load(); n != nullptr;) {
+            Node* next = n->retired_next;
+            delete n;
+            n = next;
+        }
+    }
+
+    bool add(int key) {
+        int top_level = random_skip_list_level();
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        while (true) {
+            if (find(key, preds, succs)) {
+                return false;
+            }
+            Node* new_node = new Node(key, top_level);
+            for (int level = 0; level <= top_level; ++level) {
+                new_node->next[level].store(word_of(succs[level]));
+            }
+            // 바닥 레벨 연결이 성공하는 순간 집합에 추가된 것으로 본다
+            uintptr_t expected = word_of(succs[0]);
+            if (!preds[0]->next[0].compare_exchange_strong(expected, word_of(new_node))) {
+                delete new_node;
+                continue;
+            }
+            for (int level = 1; level <= top_level; ++level) {
+                while (true) {
+                    uintptr_t node_next = new_node->next[level].load();
+                    if (is_marked(node_next)) {
+                        return true; // 그 사이 삭제가 시작되었으므로 상위 레벨 연결을 중단
+                    }
+                    if (pointer_of(node_next) != succs[level] &&
+                        !new_node->next[level].compare_exchange_strong(node_next, word_of(succs[level]))) {
+                        continue;
+                    }
+                    expected = word_of(succs[level]);
+                    if (preds[level]->next[level].compare_exchange_strong(expected, word_of(new_node))) {
+                        break;
+                    }
+                    find(key, preds, succs);
+                }
+            }
+            return true;
+        }
+    }
+
+    bool remove(int key) {
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        if (!find(key, preds, succs)) {
+            return false;
+        }
+        Node* victim = succs[0];
+        for (int level = victim->top_level; level >= 1; --level) {
+            uintptr_t succ = victim->next[level].load();
+            while (!is_marked(succ)) {
+                victim->next[level].compare_exchange_strong(succ, succ | 1);
+            }
+        }
+        uintptr_t succ = victim->next[0].load();
+        while (true) {
+            if (is_marked(succ)) {
+                return false; // 다른 스레드가 먼저 삭제
+            }
+            if (victim->next[0].compare_exchange_strong(succ, succ | 1)) {
+                find(key, preds, succs); // 물리적 삭제
+                retire(victim);
+                return true;
+            }
+        }
+    }
+
+    bool contains(int key) {
+        Node* pred = &head;
+        Node* curr = nullptr;
+        for (int level = SKIP_LIST_MAX_LEVEL; level >= 0; --level) {
+            curr = pointer_of(pred->next[level].load());
+            while (true) {
+                uintptr_t succ = curr->next[level].load();
+                while (is_marked(succ)) {
+                    curr = pointer_of(succ);
+                    succ = curr->next[level].load();
+                }
+                if (curr->key < key) {
+                    pred = curr;
+                    curr = pointer_of(succ);
+                } else {
+                    break;
+                }
+            }
+        }
+        return curr->key == key;
+    }
+
+    /**
+     * @brief [low, high] 구간의 키 개수 (바닥 레벨을 순회, 선형화 가능하지 않음)
+     */
+    int range_count(int low, int high) {
+        Node* preds[SKIP_LIST_MAX_LEVEL + 1];
+        Node* succs[SKIP_LIST_MAX_LEVEL + 1];
+        find(low, preds, succs);
+        int count = 0;
+        for (Node* curr = succs[0]; curr->key <= high && curr != &tail;) {
+            uintptr_t succ = curr->next[0].load();
+            if (!is_marked(succ)) {
+                ++count;
+            }
+            curr = pointer_of(succ);
+        }
+        return count;
+    }
+};
+
+/**
+ * @brief 집합 워크로드 설정 (옵션: --key-range, --insert, --delete, --range, --range-length)
+ * 나머지 비율은 lookup(contains) 연산이 된다.
+ */
+struct Set_Workload {
+    int key_range = 100'000;
+    int insert_percent = 10;
+    int delete_percent = 10;
+    int range_percent = 0;
+    int range_length = 100;
+};
+
+struct Set_Thread_Result {
+    long long inserted = 0;
+    long long deleted = 0;
+    long long found = 0;
+    long long range_keys = 0;
+};
+
+/**
+ * @brief 집합 스레드 작업 함수
+ */
+template<typename SetType>
+void set_worker_function(SetType& set, int num_ops, const Set_Workload& workload, unsigned seed, Set_Thread_Result& result) {
+    std::minstd_rand rng(seed);
+    Set_Thread_Result local;
+    for (int i = 0; i < num_ops; ++i) {
+        int key = rng() % workload.key_range;
+        int op = rng() % 100;
+        if (op < workload.insert_percent) {
+            local.inserted += set.add(key);
+        } else if (op < workload.insert_percent + workload.delete_percent) {
+            local.deleted += set.remove(key);
+        } else if (op < workload.insert_percent + workload.delete_percent + workload.range_percent) {
+            local.range_keys += set.range_count(key, key + workload.range_length - 1);
+        } else {
+            local.found += set.contains(key);
+        }
+    }
+    result = local;
+}
+
+/**
+ * @brief 집합 실험 실행 및 결과 측정
+ */
+template<typename SetType>
+double run_set_experiment(const string& set_name, int num_threads, const Set_Workload& workload) {
+
+    SetType set;
+
+    // 키 범위의 절반을 미리 채워 둔다
+    std::minstd_rand rng(12345);
+    int initial_size = 0;
+    for (int i = 0; i < workload.key_range / 2; ++i) {
+        initial_size += set.add(rng() % workload.key_range);
+    }
+
+    vector<Set_Thread_Result> results(num_threads);
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = SET_OPERATIONS / num_threads + (i < SET_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(set_worker_function<SetType>, ref(set), num_ops, cref(workload), i + 1, ref(results[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] 최종 크기 = 초기 크기 + 성공한 삽입 - 성공한 삭제
+    long long inserted = 0, deleted = 0;
+    for (const auto& r : results) {
+        inserted += r.inserted;
+        deleted += r.deleted;
+    }
+    long long expected_size = initial_size + inserted - deleted;
+    long long final_size = set.range_count(0, workload.key_range - 1);
+
+    cout << set_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << SET_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    cout << "Final Size = " << final_size;
+
+    bool is_correct = (final_size == expected_size);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(final_size - expected_size);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [5] 계좌 이체 워크로드 (다중 락) =========
+
+constexpr int TRANSFER_OPERATIONS = 2'000'000; // 총 이체 시도 횟수
+constexpr long long INITIAL_BALANCE = 1'000;
+
+const vector<int> account_counts = {2, 16, 1024};
+
+/**
+ * @brief 계좌 (계좌마다 독립된 LockType 락, false sharing 방지를 위해 캐시 라인 정렬)
+ */
+template<typename LockType>
+struct alignas(64) Account {
+    LockType lock;
+    long long balance = INITIAL_BALANCE;
+};
+
+/**
+ * @brief 이체 스레드 작업 함수
+ * 두 계좌의 락을 항상 주소 순서로 획득하여 교착 상태를 방지한다.
+ */
+template<typename LockType>
+void transfer_worker_function(vector<Account<LockType>>& accounts, int num_transfers, unsigned seed, long long& completed) {
+    std::minstd_rand rng(seed);
+    int num_accounts = accounts.size();
+    long long local_completed = 0;
+    for (int i = 0; i < num_transfers; ++i) {
+        int from = rng() % num_accounts;
+        int to = (from + 1 + rng() % (num_accounts - 1)) % num_accounts;
+        long long amount = rng() % 100 + 1;
+
+        Account<LockType>* first = &accounts[min(from, to)];
+        Account<LockType>* second = &accounts[max(from, to)];
+
+        first->lock.lock();
+        second->lock.lock();
+        if (accounts[from].balance >= amount) { // Critical Section: 잔액이 충분할 때만 이체
+            accounts[from].balance -= amount;
+            accounts[to].balance += amount;
+            ++local_completed;
+        }
+        second->lock.unlock();
+        first->lock.unlock();
+    }
+    completed = local_completed;
+}
+
+/**
+ * @brief 계좌 이체 실험 실행 및 결과 측정
+ */
+template<typename LockType>
+double run_bank_experiment(const string& lock_name, int num_threads, int num_accounts) {
+
+    vector<Account<LockType>> accounts(num_accounts);
+    vector<long long> completed(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_transfers = TRANSFER_OPERATIONS / num_threads + (i < TRANSFER_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(transfer_worker_function<LockType>, ref(accounts), num_transfers, i + 1, ref(completed[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] 이체 전후 총 잔액은 보존되어야 한다
+    long long expected_total = INITIAL_BALANCE * num_accounts;
+    long long total = 0;
+    for (const auto& account : accounts) {
+        total += account.balance;
+    }
+    long long total_completed = 0;
+    for (long long c : completed) {
+        total_completed += c;
+    }
+
+    cout << lock_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << TRANSFER_OPERATIONS / duration.count() / 1e6 << " Mtransfers/s, ";
+    cout << "Completed = " << total_completed << ", ";
+    cout << "Total Balance = " << total;
+
+    bool is_correct = (total == expected_total);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(total - expected_total);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [6] 소프트웨어 트랜잭셔널 메모리 (TL2) =========
+
+constexpr int STM_LOCK_STRIPES = 1 << 20; // 버전 락 스트라이프 개수 (2의 거듭제곱)
+
+/**
+ * @brief TL2 전역 상태: 전역 버전 시계와 주소 해시로 선택되는 버전 락 테이블
+ * 버전 락 워드 = (버전 << 1) | 잠금 비트
+ */
+class TL2_STM {
+public:
+    std::atomic<uint64_t> global_clock = 0;
+    std::atomic<uint64_t>* stripes;
+
+    TL2_STM() : stripes(new std::atomic<uint64_t>[STM_LOCK_STRIPES]()) {}
+    ~TL2_STM() { delete[] stripes; }
+
+    std::atomic<uint64_t>& stripe_of(const void* addr) {
+        uintptr_t word_index = reinterpret_cast<uintptr_t>(addr) >> 3;
+        return stripes[(word_index ^ (word_index >> 20)) & (STM_LOCK_STRIPES - 1)];
+    }
+};
+
+TL2_STM g_stm;
+
+// 스레드 종료 시 전역 통계에 합산되는 커밋/중단 횟수
+std::atomic<long long> g_stm_commits = 0;
+std::atomic<long long> g_stm_aborts = 0;
+
+struct STM_Thread_Stats {
+    long long commits = 0;
+    long long aborts = 0;
+    ~STM_Thread_Stats() {
+        g_stm_commits += commits;
+        g_stm_aborts += aborts;
+    }
+};
+
+thread_local STM_Thread_Stats tls_stm_stats;
+
+/**
+ * @brief TL2 트랜잭션 (워드 단위: long long)
+ * 읽기는 버전 검증 후 read set에 기록하고, 쓰기는 write set에 버퍼링했다가
+ * 커밋 시 스트라이프 락 획득 → 버전 증가 → read set 재검증 → 반영 순으로 처리한다.
+ */
+class TL2_Transaction {
+    struct Write_Entry {
+        long long* addr;
+        long long value;
+    };
+    struct Acquired_Lock {
+        std::atomic<uint64_t>* stripe;
+        uint64_t old_word;
+    };
+
+    uint64_t read_version = 0;
+    bool doomed = false; // 읽기 검증 실패: 커밋하지 않고 재시도
+    vector<std::atomic<uint64_t>*> read_set;
+    vector<Write_Entry> write_set;
+    vector<Acquired_Lock> acquired;
+
+    const Acquired_Lock* find_acquired(std::atomic<uint64_t>* stripe) const {
+        for (const auto& a : acquired) {
+            if (a.stripe == stripe) {
+                return &a;
+            }
+        }
+        return nullptr;
+    }
+
+    void release_acquired() {
+        for (const auto& a : acquired) {
+            a.stripe->store(a.old_word);
+        }
+        acquired.clear();
+    }
+
+public:
+    void begin() {
+        read_set.clear();
+        write_set.clear();
+        acquired.clear();
+        doomed = false;
+        read_version = g_stm.global_clock.load();
+    }
+
+    bool aborted() const { return doomed; }
+
+    /**
+     * @brief 검증된 읽기
+     * 충돌이 감지되면 트랜잭션을 중단 상태로 표시하고 0(널 워드)을 돌려준다. 예외를 던지지 않으므로
+     * 본문은 0을 받아도 안전해야 하며(포인터 워드는 null로 취급), 커밋은 실패하고 atomically()가 재시도한다.
+     */
+    long long read(long long* addr) {
+        if (doomed) {
+            return 0;
+        }
+        for (const auto& w : write_set) {
+            if (w.addr == addr) {
+                return w.value;
+            }
+        }
+        std::atomic<uint64_t>& stripe = g_stm.stripe_of(addr);
+        uint64_t before = stripe.load();
+        long long value = std::atomic_ref<long long>(*addr).load();
+        uint64_t after = stripe.load();
+        if ((before & 1) || before != after || (before >> 1) > read_version) {
+            doomed = true;
+            return 0;
+        }
+        read_set.push_back(&stripe);
+        return value;
+    }
+
+    void write(long long* addr, long long value) {
+        for (auto& w : write_set) {
+            if (w.addr == addr) {
+                w.value = value;
+                return;
+            }
+        }
+        write_set.push_back({addr, value});
+    }
+
+    /**
+     * @return 커밋에 성공하면 true, 충돌로 중단되면 false
+     */
+    bool commit() {
+        if (doomed) {
+            return false;
+        }
+        if (write_set.empty()) {
+            return true; // 읽기 전용 트랜잭션은 읽을 때마다 검증했으므로 바로 커밋
+        }
+
+        for (const auto& w : write_set) {
+            std::atomic<uint64_t>& stripe = g_stm.stripe_of(w.addr);
+            if (find_acquired(&stripe) != nullptr) {
+                continue;
+            }
+            uint64_t word = stripe.load();
+            if ((word & 1) || !stripe.compare_exchange_strong(word, word | 1)) {
+                release_acquired();
+                return false;
+            }
+            acquired.push_back({&stripe, word});
+        }
+
+        uint64_t write_version = g_stm.global_clock.fetch_add(1) + 1;
+
+        if (write_version != read_version + 1) {
+            for (std::atomic<uint64_t>* stripe : read_set) {
+                const Acquired_Lock* mine = find_acquired(stripe);
+                uint64_t word = mine != nullptr ? mine->old_word : stripe->load();
+                if ((mine == nullptr && (word & 1)) || (word >> 1) > read_version) {
+                    release_acquired();
+                    return false;
+                }
+            }
+        }
+
+        for (const auto& w : write_set) {
+            std::atomic_ref<long long>(*w.addr).store(w.value);
+        }
+        for (const auto& a : acquired) {
+            a.stripe->store(write_version << 1);
+        }
+        acquired.clear();
+        return true;
+    }
+};
+
+/**
+ * @brief 트랜잭션 실행 (커밋될 때까지 재시도)
+ */
+template<typename Body>
+void atomically(Body&& body) {
+    thread_local TL2_Transaction tx;
+    while (true) {
+        tx.begin();
+        body(tx);
+        if (tx.commit()) {
+            ++tls_stm_stats.commits;
+            return;
+        }
+        ++tls_stm_stats.aborts;
+        this_thread::yield();
+    }
+}
+
+/**
+ * @brief 커밋/중단 통계 출력 후 초기화
+ */
+void report_stm_stats() {
+    long long commits = g_stm_commits.exchange(0);
+    long long aborts = g_stm_aborts.exchange(0);
+    cout << "    STM: Commits = " << commits << ", Aborts = " << aborts;
+    cout << ", Abort Rate = " << (commits + aborts > 0 ? 100.0 * aborts / (commits + aborts) : 0.0) << "%" << endl;
+}
+
+/**
+ * @brief 스레드 작업 함수 (STM 트랜잭션으로 카운터 갱신)
+ */
+void worker_function_stm(long long& counter, int start_val, int end_val) {
+    for (int i = start_val; i <= end_val; ++i) {
+        atomically([&](TL2_Transaction& tx) {
+            tx.write(&counter, tx.read(&counter) + i);
+        });
+    }
+}
+
+/**
+ * @brief STM 카운터 실험 (run_experiment와 같은 작업 분배와 정확성 검증)
+ */
+double run_stm_counter_experiment(int num_threads) {
+
+    shared_counter = 0;
+
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    int current_start = START_NUM;
+    for (int i = 0; i < num_threads; ++i) {
+        int range_size = NUM_OPERATIONS / num_threads + (i < NUM_OPERATIONS % num_threads ? 1 : 0);
+        int current_end = min(current_start + range_size - 1, END_NUM);
+        threads.emplace_back(worker_function_stm, ref(shared_counter), current_start, current_end);
+        current_start = current_end + 1;
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    cout << "TL2 STM (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+
+    bool is_correct = (shared_counter == expected_result);
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+    report_stm_stats();
+
+    return duration.count();
+}
+
+/**
+ * @brief STM으로 접근하는 계좌 (락 없음)
+ */
+struct alignas(64) STM_Account {
+    long long balance = INITIAL_BALANCE;
+};
+
+/**
+ * @brief 이체 스레드 작업 함수 (STM)
+ */
+void stm_transfer_worker_function(vector<STM_Account>& accounts, int num_transfers, unsigned seed, long long& completed) {
+    std::minstd_rand rng(seed);
+    int num_accounts = accounts.size();
+    long long local_completed = 0;
+    for (int i = 0; i < num_transfers; ++i) {
+        int from = rng() % num_accounts;
+        int to = (from + 1 + rng() % (num_accounts - 1)) % num_accounts;
+        long long amount = rng() % 100 + 1;
+
+        bool done = false;
+        atomically([&](TL2_Transaction& tx) {
+            long long from_balance = tx.read(&accounts[from].balance);
+            done = from_balance >= amount;
+            if (done) {
+                tx.write(&accounts[from].balance, from_balance - amount);
+                tx.write(&accounts[to].balance, tx.read(&accounts[to].balance) + amount);
+            }
+        });
+        local_completed += done;
+    }
+    completed = local_completed;
+}
+
+/**
+ * @brief STM 계좌 이체 실험
+ */
+double run_stm_bank_experiment(int num_threads, int num_accounts) {
+
+    vector<STM_Account> accounts(num_accounts);
+    vector<long long> completed(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_transfers = TRANSFER_OPERATIONS / num_threads + (i < TRANSFER_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(stm_transfer_worker_function, ref(accounts), num_transfers, i + 1, ref(completed[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    long long expected_total = INITIAL_BALANCE * num_accounts;
+    long long total = 0;
+    for (const auto& account : accounts) {
+        total += account.balance;
+    }
+    long long total_completed = 0;
+    for (long long c : completed) {
+        total_completed += c;
+    }
+
+    cout << "TL2 STM (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << TRANSFER_OPERATIONS / duration.count() / 1e6 << " Mtransfers/s, ";
+    cout << "Completed = " << total_completed << ", ";
+    cout << "Total Balance = " << total;
+
+    bool is_correct = (total == expected_total);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(total - expected_total);
+    }
+    cout << endl;
+    report_stm_stats();
+
+    return duration.count();
+}
+
+
+// ========= [7] 해시 맵 워크로드 =========
+
+constexpr int HASH_MAP_OPERATIONS = 2'000'000; // 총 해시 맵 연산 횟수
+constexpr int HASH_MAP_BUCKET_BITS = 14;
+constexpr int HASH_MAP_BUCKETS = 1 << HASH_MAP_BUCKET_BITS;
+
+/**
+ * @brief 체이닝 해시 맵 노드 (STM이 워드 단위로 다룰 수 있도록 next도 정수로 보관)
+ * 키는 게시 이후 변하지 않으며, 삭제 연산이 없으므로 노드는 맵 소멸 시에만 해제한다.
+ */
+struct Hash_Node {
+    long long key;
+    long long value;
+    long long next; // 다음 Hash_Node의 주소
+
+    static void* operator new(size_t size) { return g_node_pool.allocate(size); }
+    static void operator delete(void* pointer, size_t size) { g_node_pool.deallocate(pointer, size); }
+};
+
+inline Hash_Node* to_hash_node(long long word) { return reinterpret_cast<Hash_Node*>(word); }
+inline long long to_word(Hash_Node* node) { return reinterpret_cast<long long>(node); }
+
+inline int hash_bucket(long long key) {
+    return (uint64_t(key) * 0x9E3779B97F4A7C15ull) >> (64 - HASH_MAP_BUCKET_BITS);
+}
+
+/**
+ * @brief 버킷마다 LockType 락을 두는 해시 맵
+ */
+template<typename LockType>
+class Locked_Hash_Map {
+    struct alignas(64) Bucket {
+        LockType lock;
+        Hash_Node* head = nullptr;
+    };
+    vector<Bucket> buckets = vector<Bucket>(HASH_MAP_BUCKETS);
+
+public:
+    ~Locked_Hash_Map() {
+        for (auto& bucket : buckets) {
+            for (Hash_Node* n = bucket.head; n != nullptr;) {
+                Hash_Node* next = to_hash_node(n->next);
+                delete n;
+                n = next;
+            }
+        }
+    }
+
+    /**
+     * @brief key의 값을 1 증가 (없으면 1로 삽입)
+     */
+    void increment(long long key) {
+        Bucket& bucket = buckets[hash_bucket(key)];
+        bucket.lock.lock();
+        for (Hash_Node* n = bucket.head; n != nullptr; n = to_hash_node(n->next)) {
+            if (n->key == key) {
+                ++n->value;
+                bucket.lock.unlock();
+                return;
+            }
+        }
+        bucket.head = new Hash_Node{key, 1, to_word(bucket.head)};
+        bucket.lock.unlock();
+    }
+
+    long long get(long long key) {
+        Bucket& bucket = buckets[hash_bucket(key)];
+        long long value = 0;
+        bucket.lock.lock();
+        for (Hash_Node* n = bucket.head; n != nullptr; n = to_hash_node(n->next)) {
+            if (n->key == key) {
+                value = n->value;
+                break;
+            }
+        }
+        bucket.lock.unlock();
+        return value;
+    }
+
+    long long total() {
+        long long sum = 0;
+        for (auto& bucket : buckets) {
+            for (Hash_Node* n = bucket.head; n != nullptr; n = to_hash_node(n->next)) {
+                sum += n->value;
+            }
+        }
+        return sum;
+    }
+};
+
+/**
+ * @brief 모든 버킷/노드 접근을 TL2 트랜잭션으로 수행하는 해시 맵
+ */
+class STM_Hash_Map {
+    vector<long long> heads = vector<long long>(HASH_MAP_BUCKETS, 0);
+
+public:
+    ~STM_Hash_Map() {
+        for (long long head : heads) {
+            for (Hash_Node* n = to_hash_node(head); n != nullptr;) {
+                Hash_Node* next = to_hash_node(n->next);
+                delete n;
+                n = next;
+            }
+        }
+    }
+
+    void increment(long long key) {
+        long long* head = &heads[hash_bucket(key)];
+        // 키가 없을 때만 노드가 필요하다. 중단될 수 있는 트랜잭션 안에서는 할당하지 않으므로,
+        // 노드 없이 키가 없음을 확인하면 (읽기 전용으로 커밋하고) 밖에서 할당한 뒤 다시 시도한다.
+        Hash_Node* new_node = nullptr;
+        bool inserted = false;
+        bool need_node = true;
+        while (need_node) {
+            atomically([&](TL2_Transaction& tx) {
+                inserted = false;
+                need_node = false;
+                long long first = tx.read(head);
+                for (long long w = first; w != 0; w = tx.read(&to_hash_node(w)->next)) {
+                    Hash_Node* n = to_hash_node(w);
+                    if (n->key == key) {
+                        tx.write(&n->value, tx.read(&n->value) + 1);
+                        return;
+                    }
+                }
+                if (new_node == nullptr) {
+                    need_node = true;
+                    return;
+                }
+                new_node->next = first;
+                tx.write(head, to_word(new_node));
+                inserted = true;
+            });
+            if (need_node) {
+                new_node = new Hash_Node{key, 1, 0};
+            }
+        }
+        if (new_node != nullptr && !inserted) {
+            delete new_node; // 다시 시도하는 사이 다른 스레드가 같은 키를 넣었다
+        }
+    }
+
+    long long get(long long key) {
+        long long* head = &heads[hash_bucket(key)];
+        long long value = 0;
+        atomically([&](TL2_Transaction& tx) {
+            value = 0;
+            for (long long w = tx.read(head); w != 0; w = tx.read(&to_hash_node(w)->next)) {
+                Hash_Node* n = to_hash_node(w);
+                if (n->key == key) {
+                    value = tx.read(&n->value);
+                    return;
+                }
+            }
+        });
+        return value;
+    }
+
+    long long total() {
+        long long sum = 0;
+        for (long long head : heads) {
+            for (Hash_Node* n = to_hash_node(head); n != nullptr; n = to_hash_node(n->next)) {
+                sum += n->value;
+            }
+        }
+        return sum;
+    }
+};
+
+/**
+ * @brief 해시 맵 스레드 작업 함수
+ * @param update_percent increment 연산 비율 (%), 나머지는 get
+ */
+template<typename MapType>
+void hash_map_worker_function(MapType& map, int num_ops, int key_range, int update_percent, unsigned seed, long long& updates) {
+    std::minstd_rand rng(seed);
+    long long local_updates = 0;
+    for (int i = 0; i < num_ops; ++i) {
+        long long key = rng() % key_range;
+        if (int(rng() % 100) < update_percent) {
+            map.increment(key);
+            ++local_updates;
+        } else {
+            map.get(key);
+        }
+    }
+    updates = local_updates;
+}
+
+/**
+ * @brief 해시 맵 실험 실행 및 결과 측정
+ */
+template<typename MapType>
+double run_hash_map_experiment(const string& map_name, int num_threads, int key_range, int update_percent) {
+
+    MapType map;
+    vector<long long> updates(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = HASH_MAP_OPERATIONS / num_threads + (i < HASH_MAP_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(hash_map_worker_function<MapType>, ref(map), num_ops, key_range, update_percent, i + 1, ref(updates[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] 모든 값의 합 = 성공한 increment 횟수
+    long long expected_total = 0;
+    for (long long u : updates) {
+        expected_total += u;
+    }
+    long long total = map.total();
+
+    cout << map_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << HASH_MAP_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    cout << "Total = " << total;
+
+    bool is_correct = (total == expected_total);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(total - expected_total);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [8] 읽기 위주 워크로드 (RW / Optimistic Lock) =========
+
+constexpr int READ_MOSTLY_OPERATIONS = 4'000'000; // 총 읽기/쓰기 연산 횟수
+constexpr int RECORD_WORDS = 8;
+
+/**
+ * @brief 읽기 위주 워크로드의 공유 레코드
+ * writer는 모든 워드를 같은 값으로 갱신하므로, 일관된 읽기라면 모든 워드가 같아야 한다.
+ * (Optimistic Lock의 reader는 writer와 동시에 읽을 수 있으므로 워드는 atomic_ref로 접근한다.)
+ */
+struct alignas(64) Shared_Record {
+    long long words[RECORD_WORDS] = {};
+};
+
+/**
+ * @brief 락 종류에 맞는 방식으로 레코드를 읽는다
+ * Optimistic Lock은 검증 재시도, RW Lock은 공유 모드, 나머지는 배타 락을 사용한다.
+ */
+template<typename LockType>
+void read_record(LockType& lock_instance, Shared_Record& record, long long out[]) {
+    auto copy_words = [&]() {
+        for (int w = 0; w < RECORD_WORDS; ++w) {
+            out[w] = std::atomic_ref<long long>(record.words[w]).load(std::memory_order_relaxed);
+        }
+    };
+    if constexpr (requires { lock_instance.read_begin(); }) {
+        while (true) {
+            uint64_t version = lock_instance.read_begin();
+            copy_words();
+            if (lock_instance.read_validate(version)) {
+                return;
+            }
+        }
+    } else if constexpr (requires { lock_instance.lock_shared(); }) {
+        lock_instance.lock_shared();
+        copy_words();
+        lock_instance.unlock_shared();
+    } else {
+        lock_instance.lock();
+        copy_words();
+        lock_instance.unlock();
+    }
+}
+
+template<typename LockType>
+void write_record(LockType& lock_instance, Shared_Record& record) {
+    lock_instance.lock();
+    long long next_value = record.words[0] + 1;
+    for (int w = 0; w < RECORD_WORDS; ++w) {
+        std::atomic_ref<long long>(record.words[w]).store(next_value, std::memory_order_relaxed);
+    }
+    lock_instance.unlock();
+}
+
+struct Read_Thread_Result {
+    long long reads = 0;
+    long long writes = 0;
+    long long torn_reads = 0; // 워드가 서로 다른 값을 가진 읽기 (0이어야 함)
+};
+
+/**
+ * @brief 읽기 위주 스레드 작업 함수
+ * @param write_percent 쓰기 연산 비율 (%)
+ */
+template<typename LockType>
+void read_mostly_worker_function(LockType& lock_instance, Shared_Record& record, int num_ops, int write_percent, unsigned seed, Read_Thread_Result& result) {
+    std::minstd_rand rng(seed);
+    Read_Thread_Result local;
+    long long snapshot[RECORD_WORDS];
+    for (int i = 0; i < num_ops; ++i) {
+        if (int(rng() % 100) < write_percent) {
+            write_record(lock_instance, record);
+            ++local.writes;
+        } else {
+            read_record(lock_instance, record, snapshot);
+            ++local.reads;
+            for (int w = 1; w < RECORD_WORDS; ++w) {
+                if (snapshot[w] != snapshot[0]) {
+                    ++local.torn_reads;
+                    break;
+                }
+            }
+        }
+    }
+    result = local;
+}
+
+/**
+ * @brief 읽기 위주 실험 실행 및 결과 측정
+ */
+template<typename LockType>
+double run_read_mostly_experiment(const string& lock_name, int num_threads, int write_percent) {
+
+    LockType lock_instance;
+    Shared_Record record;
+    vector<Read_Thread_Result> results(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = READ_MOSTLY_OPERATIONS / num_threads + (i < READ_MOSTLY_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(read_mostly_worker_function<LockType>, ref(lock_instance), ref(record), num_ops, write_percent, i + 1, ref(results[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] 찢어진 읽기가 없고, 최종 값 = 총 쓰기 횟수
+    long long reads = 0, writes = 0, torn_reads = 0;
+    for (const auto& r : results) {
+        reads += r.reads;
+        writes += r.writes;
+        torn_reads += r.torn_reads;
+    }
+
+    cout << lock_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Read Throughput = " << reads / duration.count() / 1e6 << " Mops/s, ";
+    cout << "Writes = " << writes;
+
+    bool is_correct = (torn_reads == 0 && record.words[0] == writes);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Torn Reads = " << torn_reads << ", Error = " << abs(record.words[0] - writes);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [9] 코루틴 기반 비동기 락 =========
+
+/**
+ * @brief 코루틴 핸들을 실행하는 스레드 풀 (워커마다 독립된 실행 큐)
+ * 워커 스레드 안에서 post()하면 그 워커 자신의 큐에 들어간다.
+ */
+class Executor {
+    struct Worker {
+        std::mutex queue_mutex;
+        std::condition_variable queue_cv;
+        std::deque<std::coroutine_handle<>> ready;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    vector<thread> threads;
+    std::atomic<bool> stopping = false;
+    std::atomic<unsigned> next_worker = 0;
+
+    static thread_local Worker* current_worker;
+
+    void run_worker(Worker* worker) {
+        current_worker = worker;
+        while (true) {
+            std::coroutine_handle<> handle;
+            {
+                std::unique_lock<std::mutex> guard(worker->queue_mutex);
+                worker->queue_cv.wait(guard, [&] { return !worker->ready.empty() || stopping.load(); });
+                if (worker->ready.empty()) {
+                    return;
+                }
+                handle = worker->ready.front();
+                worker->ready.pop_front();
+            }
+            handle.resume();
+        }
+    }
+
+    static void push(Worker* worker, std::coroutine_handle<> handle) {
+        {
+            std::lock_guard<std::mutex> guard(worker->queue_mutex);
+            worker->ready.push_back(handle);
+        }
+        worker->queue_cv.notify_one();
+    }
+
+public:
+    explicit Executor(int num_threads) {
+        for (int i = 0; i < num_threads; ++i) {
+            workers.push_back(make_unique<Worker>());
+        }
+        for (int i = 0; i < num_threads; ++i) {
+            threads.emplace_back(&Executor::run_worker, this, workers[i].get());
+        }
+    }
+
+    ~Executor() {
+        stopping.store(true);
+        for (auto& worker : workers) {
+            std::lock_guard<std::mutex> guard(worker->queue_mutex);
+            worker->queue_cv.notify_all();
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    /**
+     * @brief 외부 스레드에서 코루틴을 워커들에 라운드 로빈으로 분배
+     */
+    void spawn(std::coroutine_handle<> handle) {
+        push(workers[next_worker.fetch_add(1) % workers.size()].get(), handle);
+    }
+
+    /**
+     * @brief 현재 워커의 큐에 코루틴을 넣는다 (워커 스레드가 아니면 즉시 재개)
+     */
+    static void post_local(std::coroutine_handle<> handle) {
+        if (current_worker != nullptr) {
+            push(current_worker, handle);
+        } else {
+            handle.resume();
+        }
+    }
+};
+
+thread_local Executor::Worker* Executor::current_worker = nullptr;
+
+/**
+ * @brief 결과를 기다리지 않는 코루틴 (생성 직후 중단되어 Executor::spawn으로 시작)
+ */
+struct Detached_Task {
+    struct promise_type {
+        Detached_Task get_return_object() {
+            return {std::coroutine_handle<promise_type>::from_promise(*this)};
+        }
+        std::suspend_always initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() {}
+        void unhandled_exception() { std::terminate(); }
+    };
+    std::coroutine_handle<promise_type> handle;
+};
+
+/**
+ * @brief 6. 코루틴 비동기 Mutex 구현 (co_await lock.lock_async())
+ * 상태 워드: NOT_LOCKED / LOCKED_NO_WAITERS / 새로 도착한 대기자 스택(LIFO)의 머리.
+ * 해제 시 대기자를 FIFO 순서로 꺼내 락 소유권을 넘겨주고, 그 코루틴은
+ * 해제한 스레드의 Executor 큐에서 재개된다. 대기 중인 코루틴은 스레드를 점유하지 않는다.
+ */
+class Async_Mutex {
+    static constexpr uintptr_t NOT_LOCKED = 1;
+    static constexpr uintptr_t LOCKED_NO_WAITERS = 0;
+
+public:
+    struct Lock_Awaiter {
+        Async_Mutex& mutex;
+        std::coroutine_handle<> handle;
+        Lock_Awaiter* next = nullptr;
+
+        bool await_ready() {
+            return mutex.try_lock();
+        }
+        bool await_suspend(std::coroutine_handle<> awaiting) {
+            handle = awaiting;
+            uintptr_t old_state = mutex.state.load();
+            while (true) {
+                if (old_state == NOT_LOCKED) {
+                    if (mutex.state.compare_exchange_weak(old_state, LOCKED_NO_WAITERS)) {
+                        return false; // 그 사이 풀렸으므로 중단하지 않고 바로 획득
+                    }
+                } else {
+                    next = reinterpret_cast<Lock_Awaiter*>(old_state);
+                    if (mutex.state.compare_exchange_weak(old_state, reinterpret_cast<uintptr_t>(this))) {
+                        return true;
+                    }
+                }
+            }
+        }
+        void await_resume() {}
+    };
+
+    bool try_lock() {
+        uintptr_t expected = NOT_LOCKED;
+        return state.compare_exchange_strong(expected, LOCKED_NO_WAITERS);
+    }
+
+    Lock_Awaiter lock_async() {
+        return Lock_Awaiter{*this, nullptr};
+    }
+
+    void unlock() {
+        Lock_Awaiter* waiter = fifo_waiters;
+        if (waiter == nullptr) {
+            uintptr_t old_state = LOCKED_NO_WAITERS;
+            if (state.compare_exchange_strong(old_state, NOT_LOCKED)) {
+                return;
+            }
+            // 새로 도착한 대기자 스택을 가져와 FIFO 순서로 뒤집는다
+            old_state = state.exchange(LOCKED_NO_WAITERS);
+            for (Lock_Awaiter* w = reinterpret_cast<Lock_Awaiter*>(old_state); w != nullptr;) {
+                Lock_Awaiter* next = w->next;
+                w->next = waiter;
+                waiter = w;
+                w = next;
+            }
+        }
+        fifo_waiters = waiter->next;
+        Executor::post_local(waiter->handle); // 락 소유권을 넘긴 채로 재개
+    }
+
+private:
+    std::atomic<uintptr_t> state = NOT_LOCKED;
+    Lock_Awaiter* fifo_waiters = nullptr; // 락 소유자만 접근
+};
+
+/**
+ * @brief 코루틴 작업 함수 (Async_Mutex 사용)
+ */
+Detached_Task async_worker_function(Async_Mutex& mutex, long long& counter, int start_val, int end_val, std::atomic<int>& remaining) {
+    for (int i = start_val; i <= end_val; ++i) {
+        co_await mutex.lock_async();
+        counter += i; // Critical Section: 실제 숫자를 공유 카운터에 더함
+        mutex.unlock();
+    }
+    if (remaining.fetch_sub(1) == 1) {
+        remaining.notify_all();
+    }
+}
+
+/**
+ * @brief 코루틴 실험 실행 (num_coroutines개의 코루틴을 num_executor_threads개 스레드에서 실행)
+ */
+double run_async_experiment(int num_coroutines, int num_executor_threads) {
+
+    shared_counter = 0;
+    Async_Mutex mutex;
+
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+    std::atomic<int> remaining = num_coroutines;
+    chrono::duration<double> duration;
+    {
+        Executor executor(num_executor_threads);
+        auto start_time = timer_now();
+
+        int current_start = START_NUM;
+        for (int i = 0; i < num_coroutines; ++i) {
+            int range_size = NUM_OPERATIONS / num_coroutines + (i < NUM_OPERATIONS % num_coroutines ? 1 : 0);
+            int current_end = min(current_start + range_size - 1, END_NUM);
+            executor.spawn(async_worker_function(mutex, shared_counter, current_start, current_end, remaining).handle);
+            current_start = current_end + 1;
+        }
+
+        // 모든 코루틴 종료 대기
+        for (int left = remaining.load(); left != 0; left = remaining.load()) {
+            remaining.wait(left);
+        }
+
+        auto end_time = timer_now_end();
+        duration = timer_elapsed(start_time, end_time);
+    }
+
+    cout << "Async Mutex (" << num_coroutines << " coroutines on " << num_executor_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+
+    bool is_correct = (shared_counter == expected_result);
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [10] Per-CPU 카운터 (rseq) =========
+
+/**
+ * @brief 현재 스레드의 rseq 영역 준비
+ * glibc(2.35+)가 이미 등록해 둔 영역이 있으면 그것을 쓰고, 없으면 직접 rseq 시스템 콜로 등록한다.
+ * @param offset 성공 시 스레드 포인터 기준 struct rseq의 오프셋 (음수일 수 있음)
+ * @return rseq를 사용할 수 있으면 true
+ */
+bool rseq_thread_offset(long& offset) {
+#ifdef HAVE_RSEQ
+    struct Registration {
+        bool registered = false;
+        long offset = 0;
+    };
+    thread_local Registration registration = [] {
+        if (__rseq_size > 0) {
+            return Registration{true, long(__rseq_offset)};
+        }
+        alignas(32) static thread_local struct rseq own_area = {};
+        own_area.cpu_id = RSEQ_CPU_ID_UNINITIALIZED;
+        if (syscall(SYS_rseq, &own_area, sizeof(own_area), 0, RSEQ_SIG) != 0) {
+            return Registration{};
+        }
+        return Registration{true, long(reinterpret_cast<char*>(&own_area) - static_cast<char*>(__builtin_thread_pointer()))};
+    }();
+    offset = registration.offset;
+    return registration.registered;
+#else
+    (void)offset;
+    return false;
+#endif
+}
+
+#ifdef HAVE_RSEQ
+static_assert(offsetof(struct rseq, cpu_id) == 4 && offsetof(struct rseq, rseq_cs) == 8, "unexpected struct rseq layout");
+
+/**
+ * @brief rseq 임계 구역 안에서 *value += count (x86-64)
+ * 시작 후 커밋(addq) 전에 선점·마이그레이션·시그널이 발생하거나 CPU가 바뀌었으면
+ * 커널이 abort 핸들러로 보내며, 이 경우 false를 반환한다.
+ */
+inline bool rseq_add(long long* value, long long count, int cpu, long rseq_offset) {
+    asm goto(
+        ".pushsection __rseq_cs, \"aw\"\n\t"
+        ".balign 32\n\t"
+        "3:\n\t"
+        ".long 0x0, 0x0\n\t"
+        ".quad 1f, (2f - 1f), 4f\n\t"
+        ".popsection\n\t"
+        "leaq 3b(%%rip), %%rax\n\t"
+        "movq %%rax, %%fs:8(%[rseq_offset])\n\t"
+        "1:\n\t"
+        "cmpl %[cpu], %%fs:4(%[rseq_offset])\n\t"
+        "jnz 4f\n\t"
+        "addq %[count], %[value]\n\t"
+        "2:\n\t"
+        ".pushsection __rseq_failure, \"ax\"\n\t"
+        ".byte 0x0f, 0xb9, 0x3d\n\t"
+        ".long 0x53053053\n\t" // RSEQ_SIG
+        "4:\n\t"
+        "jmp %l[aborted]\n\t"
+        ".popsection\n\t"
+        :
+        : [cpu] "r"(cpu), [rseq_offset] "r"(rseq_offset), [value] "m"(*value), [count] "er"(count)
+        : "memory", "cc", "rax"
+        : aborted);
+    return true;
+aborted:
+    return false;
+}
+#endif
+
+/**
+ * @brief CPU마다 캐시 라인 하나씩 슬롯을 두는 카운터
+ * rseq를 쓸 수 있으면 원자 연산 없이 현재 CPU 슬롯에 더하고,
+ * 아니면 sched_getcpu()로 고른 슬롯에 atomic fetch_add로 더한다.
+ */
+class Per_CPU_Counter {
+    struct alignas(64) Slot {
+        long long rseq_value = 0;                 // rseq 임계 구역에서만 갱신
+        std::atomic<long long> shared_value = 0;  // sched_getcpu() 대체 경로
+    };
+
+    int num_slots = max(1, get_nprocs_conf());
+    unique_ptr<Slot[]> slots = make_unique<Slot[]>(num_slots);
+
+public:
+    /**
+     * @param aborts rseq 임계 구역이 중단되어 재시도한 횟수를 누적
+     */
+    void add(long long count, long long& aborts) {
+#ifdef HAVE_RSEQ
+        long offset;
+        if (rseq_thread_offset(offset)) {
+            while (true) {
+                int cpu = *reinterpret_cast<volatile uint32_t*>(static_cast<char*>(__builtin_thread_pointer()) + offset + 4);
+                if (rseq_add(&slots[cpu % num_slots].rseq_value, count, cpu, offset)) {
+                    return;
+                }
+                ++aborts;
+            }
+        }
+#endif
+        int cpu = sched_getcpu();
+        slots[(cpu < 0 ? 0 : cpu) % num_slots].shared_value.fetch_add(count);
+    }
+
+    long long sum() const {
+        long long total = 0;
+        for (int i = 0; i < num_slots; ++i) {
+            total += slots[i].rseq_value + slots[i].shared_value.load();
+        }
+        return total;
+    }
+};
+
+/**
+ * @brief 스레드 작업 함수 (Per-CPU 카운터 사용)
+ */
+void worker_function_per_cpu(Per_CPU_Counter& counter, int start_val, int end_val, long long& aborts) {
+    long long local_aborts = 0;
+    for (int i = start_val; i <= end_val; ++i) {
+        counter.add(i, local_aborts);
+    }
+    aborts = local_aborts;
+}
+
+/**
+ * @brief Per-CPU 카운터 실험 (run_experiment와 같은 작업 분배와 정확성 검증)
+ */
+double run_per_cpu_experiment(int num_threads) {
+
+    shared_counter = 0;
+    Per_CPU_Counter counter;
+    vector<long long> aborts(num_threads);
+
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    int current_start = START_NUM;
+    for (int i = 0; i < num_threads; ++i) {
+        int range_size = NUM_OPERATIONS / num_threads + (i < NUM_OPERATIONS % num_threads ? 1 : 0);
+        int current_end = min(current_start + range_size - 1, END_NUM);
+        threads.emplace_back(worker_function_per_cpu, ref(counter), current_start, current_end, ref(aborts[i]));
+        current_start = current_end + 1;
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    shared_counter = counter.sum();
+    long long total_aborts = 0;
+    for (long long a : aborts) {
+        total_aborts += a;
+    }
+
+    long offset;
+    cout << (rseq_thread_offset(offset) ? "Per-CPU Counter (rseq)" : "Per-CPU Counter (sched_getcpu)");
+    cout << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << NUM_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    cout << "rseq Aborts = " << total_aborts << ", ";
+
+    bool is_correct = (shared_counter == expected_result);
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [11] 혼합 우선순위 워크로드 =========
+
+constexpr int PRIORITY_OPERATIONS_PER_THREAD = 100'000;
+
+/**
+ * @brief 현재 스레드의 우선순위 조정
+ * 높은 우선순위: use_rt이면 SCHED_FIFO 시도 (권한이 없으면 실패), 아니면 그대로 둔다.
+ * 낮은 우선순위: nice 값을 10으로 올린다 (권한 없이 가능).
+ * @return 요청한 우선순위가 적용되었으면 true
+ */
+bool apply_thread_priority(bool high_priority, bool use_rt) {
+    if (high_priority) {
+        if (!use_rt) {
+            return true;
+        }
+        sched_param param{};
+        param.sched_priority = sched_get_priority_min(SCHED_FIFO);
+        return pthread_setschedparam(pthread_self(), SCHED_FIFO, &param) == 0;
+    }
+    return setpriority(PRIO_PROCESS, thread_tid(), 10) == 0;
+}
+
+struct Priority_Thread_Result {
+    vector<long long> latencies_ns; // lock() 호출부터 획득까지 걸린 시간
+    bool priority_applied = false;
+};
+
+/**
+ * @brief 혼합 우선순위 스레드 작업 함수 (획득 지연 시간 측정)
+ */
+template<typename LockType>
+void priority_worker_function(LockType& lock_instance, long long& counter, bool high_priority, bool use_rt, Priority_Thread_Result& result) {
+    result.priority_applied = apply_thread_priority(high_priority, use_rt);
+    result.latencies_ns.reserve(PRIORITY_OPERATIONS_PER_THREAD);
+    for (int i = 0; i < PRIORITY_OPERATIONS_PER_THREAD; ++i) {
+        uint64_t request_time = timer_now();
+        lock_instance.lock();
+        uint64_t acquire_time = timer_now_end();
+        counter += 1; // Critical Section
+        lock_instance.unlock();
+        result.latencies_ns.push_back(timer_elapsed_ns(request_time, acquire_time));
+    }
+}
+
+/**
+ * @brief 지연 시간 요약 출력 (평균 / p99 / 최대, 단위 us)
+ */
+void print_latency_summary(const string& label, vector<long long>& latencies_ns) {
+    if (latencies_ns.empty()) {
+        return;
+    }
+    double sum = 0;
+    for (long long l : latencies_ns) {
+        sum += l;
+    }
+    size_t p99_index = latencies_ns.size() * 99 / 100;
+    nth_element(latencies_ns.begin(), latencies_ns.begin() + p99_index, latencies_ns.end());
+    long long p99 = latencies_ns[p99_index];
+    long long max_latency = *max_element(latencies_ns.begin(), latencies_ns.end());
+    cout << label << " Latency avg/p99/max = " << sum / latencies_ns.size() / 1000 << "/" << p99 / 1000.0 << "/" << max_latency / 1000.0 << " us";
+}
+
+/**
+ * @brief 혼합 우선순위 실험 실행 (스레드 4개 중 1개가 높은 우선순위)
+ */
+template<typename LockType>
+double run_priority_experiment(const string& lock_name, int num_threads, bool use_rt) {
+
+    shared_counter = 0;
+    LockType lock_instance;
+    vector<Priority_Thread_Result> results(num_threads);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        bool high_priority = (i % 4 == 0);
+        threads.emplace_back(priority_worker_function<LockType>, ref(lock_instance), ref(shared_counter), high_priority, use_rt, ref(results[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    vector<long long> high_latencies, low_latencies;
+    int applied = 0;
+    for (int i = 0; i < num_threads; ++i) {
+        auto& target = (i % 4 == 0) ? high_latencies : low_latencies;
+        target.insert(target.end(), results[i].latencies_ns.begin(), results[i].latencies_ns.end());
+        applied += results[i].priority_applied;
+    }
+
+    cout << lock_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    print_latency_summary("High-Prio", high_latencies);
+    cout << ", ";
+    print_latency_summary("Low-Prio", low_latencies);
+
+    long long expected_result = (long long)PRIORITY_OPERATIONS_PER_THREAD * num_threads;
+    bool is_correct = (shared_counter == expected_result);
+    cout << ", Final Count = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    if (applied != num_threads) {
+        cout << " [priority applied to " << applied << "/" << num_threads << " threads]";
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [12] 다수 객체 워크로드 (객체마다 락) =========
+
+constexpr int OBJECT_OPERATIONS = 4'000'000; // 총 객체 갱신 횟수
+
+const vector<int> object_counts = {1'000, 10'000, 100'000, 1'000'000, 10'000'000};
+
+/**
+ * @brief 락이 내장된 객체 (락 크기가 그대로 객체 크기에 반영되도록 패딩하지 않는다)
+ */
+template<typename LockType>
+struct Locked_Object {
+    LockType lock;
+    long long value = 0;
+};
+
+/**
+ * @brief Zipf 분포 난수 생성기 (Gray et al., "Quickly Generating Billion-Record Synthetic Databases")
+ * theta = 0이면 균등 분포. 순위 r을 곱셈 해시로 섞어서, 인기 객체들이 메모리상에서
+ * 서로 붙어 있지 않도록 한다.
+ */
+class Zipf_Generator {
+    uint64_t n;
+    double theta;
+    double alpha = 0, zetan = 0, eta = 0;
+
+public:
+    Zipf_Generator(uint64_t n, double theta) : n(n), theta(theta) {
+        if (theta <= 0) {
+            return;
+        }
+        for (uint64_t i = 1; i <= n; ++i) {
+            zetan += 1.0 / pow(double(i), theta);
+        }
+        double zeta2 = 1.0 + 1.0 / pow(2.0, theta);
+        alpha = 1.0 / (1.0 - theta);
+        eta = (1.0 - pow(2.0 / n, 1.0 - theta)) / (1.0 - zeta2 / zetan);
+    }
+
+    template<typename Rng>
+    uint64_t next(Rng& rng) const {
+        if (theta <= 0) {
+            return rng() % n;
+        }
+        double u = double(rng() - Rng::min()) / (double(Rng::max() - Rng::min()) + 1.0);
+        double uz = u * zetan;
+        uint64_t rank;
+        if (uz < 1.0) {
+            rank = 0;
+        } else if (uz < 1.0 + pow(0.5, theta)) {
+            rank = 1;
+        } else {
+            rank = min<uint64_t>(n - 1, uint64_t(n * pow(eta * u - eta + 1.0, alpha)));
+        }
+        return (rank * 2654435761ull) % n;
+    }
+};
+
+/**
+ * @brief 다수 객체 스레드 작업 함수 (Zipf 분포로 객체를 골라 락을 잡고 갱신)
+ */
+template<typename LockType>
+void object_worker_function(vector<Locked_Object<LockType>>& objects, const Zipf_Generator& zipf, int num_ops, unsigned seed) {
+    std::minstd_rand rng(seed);
+    for (int i = 0; i < num_ops; ++i) {
+        Locked_Object<LockType>& object = objects[zipf.next(rng)];
+        object.lock.lock();
+        object.value += 1; // Critical Section
+        object.lock.unlock();
+    }
+}
+
+/**
+ * @brief 다수 객체 실험 실행 및 결과 측정 (처리량, 락 메모리, LLC 미스율)
+ */
+template<typename LockType>
+double run_object_experiment(const string& lock_name, int num_threads, int num_objects, const Zipf_Generator& zipf) {
+
+    vector<Locked_Object<LockType>> objects(num_objects);
+
+    Perf_Counter llc_references(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_REFERENCES);
+    Perf_Counter llc_misses(PERF_TYPE_HARDWARE, PERF_COUNT_HW_CACHE_MISSES);
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = OBJECT_OPERATIONS / num_threads + (i < OBJECT_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(object_worker_function<LockType>, ref(objects), cref(zipf), num_ops, i + 1);
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+    // 아래 검증 루프의 미스가 섞이지 않도록 join 직후에 읽어 둔다
+    bool llc_valid = llc_references.valid() && llc_misses.valid();
+    long long references = llc_references.read_value();
+    long long misses = llc_misses.read_value();
+
+    // [**정확성 검증**] 모든 객체 값의 합 = 총 갱신 횟수
+    long long total = 0;
+    for (const auto& object : objects) {
+        total += object.value;
+    }
+
+    cout << lock_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << OBJECT_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    cout << "Lock Memory = " << double(sizeof(LockType)) * num_objects / (1 << 20) << " MiB, ";
+    cout << "Object Memory = " << double(sizeof(Locked_Object<LockType>)) * num_objects / (1 << 20) << " MiB, ";
+    if (llc_valid) {
+        cout << "LLC Miss Rate = " << (references > 0 ? 100.0 * misses / references : 0.0) << "% ";
+        cout << "(" << double(misses) / OBJECT_OPERATIONS << " misses/op), ";
+    } else {
+        cout << "LLC Miss Rate = n/a, ";
+    }
+    cout << "Total = " << total;
+
+    bool is_correct = (total == OBJECT_OPERATIONS);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(total - OBJECT_OPERATIONS);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+
+// ========= [13] 배리어 (Barrier) =========
+
+constexpr int BARRIER_EPISODES = 20'000; // 스레드마다 통과할 배리어 횟수
+
+/**
+ * @brief 배리어 대기 방식
+ */
+enum class Barrier_Wait {
+    Spin, // 스핀 (오래 걸리면 yield)
+    Park  // 잠깐 스핀 후 futex로 잠든다
+};
+
+// 배리어 word의 잠든 스레드 표시 비트 (sense 값은 0/1만 쓴다)
+constexpr uint32_t BARRIER_SLEEPERS = 2;
+
+/**
+ * @brief word가 value가 될 때까지 기다린다
+ * Park 방식은 잠들기 전에 BARRIER_SLEEPERS 비트를 세워, 신호하는 쪽이 잠든 스레드가 있을 때만 futex_wake를 부르게 한다.
+ */
+template<Barrier_Wait Wait>
+void barrier_wait_until(std::atomic<uint32_t>& word, uint32_t value) {
+    if constexpr (Wait == Barrier_Wait::Spin) {
+        spin_until([&] { return word.load() == value; });
+    } else {
+        constexpr int SPIN_LIMIT = 100;
+        for (int i = 0; i < SPIN_LIMIT; ++i) {
+            if (word.load() == value) {
+                return;
+            }
+        }
+        uint32_t current;
+        while (((current = word.load()) & ~BARRIER_SLEEPERS) != value) {
+            if (!(current & BARRIER_SLEEPERS) && !word.compare_exchange_weak(current, current | BARRIER_SLEEPERS)) {
+                continue;
+            }
+            futex_wait(word, current | BARRIER_SLEEPERS);
+        }
+    }
+}
+
+/**
+ * @brief word에 value를 쓰고, Park 방식이면 그 word에서 잠든 스레드가 있을 때만 모두 깨운다
+ */
+template<Barrier_Wait Wait>
+void barrier_signal(std::atomic<uint32_t>& word, uint32_t value) {
+    if constexpr (Wait == Barrier_Wait::Park) {
+        if (word.exchange(value) & BARRIER_SLEEPERS) {
+            futex_wake(word, INT32_MAX);
+        }
+    } else {
+        word.store(value);
+    }
+}
+
+/**
+ * @brief 스레드별 지역 상태 (false sharing 방지용 패딩)
+ */
+struct alignas(64) Barrier_Thread_State {
+    uint32_t sense = 1;
+    uint32_t parity = 0;
+};
+
+/**
+ * @brief 1. 중앙 집중식 Sense-Reversing 배리어
+ * 모두가 하나의 카운터에 도착하고, 마지막 도착자가 공유 sense를 뒤집어 전원을 풀어 준다.
+ */
+template<Barrier_Wait Wait>
+class Central_Barrier {
+    int num_threads;
+    alignas(64) std::atomic<int> count = 0;
+    alignas(64) std::atomic<uint32_t> sense = 0;
+    vector<Barrier_Thread_State> states;
+public:
+    explicit Central_Barrier(int num_threads) : num_threads(num_threads), states(num_threads) {}
+
+    void wait(int id) {
+        uint32_t my_sense = states[id].sense;
+        states[id].sense ^= 1;
+        if (count.fetch_add(1) == num_threads - 1) {
+            count.store(0);
+            barrier_signal<Wait>(sense, my_sense);
+        } else {
+            barrier_wait_until<Wait>(sense, my_sense);
+        }
+    }
+};
+
+/**
+ * @brief 2. Combining-Tree 배리어 (fan-in 2)
+ * 스레드 둘씩 잎 노드에 도착하고, 각 노드의 마지막 도착자만 부모로 올라간다.
+ * 루트의 마지막 도착자부터 내려오며 노드별 sense를 뒤집어 대기자를 푼다.
+ */
+template<Barrier_Wait Wait>
+class Combining_Tree_Barrier {
+    static constexpr int FAN_IN = 2;
+
+    struct alignas(64) Tree_Node {
+        std::atomic<int> count = 0;
+        int expected = 0;
+        std::atomic<uint32_t> sense = 0;
+    };
+
+    vector<vector<Tree_Node>> levels; // levels[0]이 잎, levels.back()이 루트
+    vector<Barrier_Thread_State> states;
+
+    void arrive(size_t level, int index, uint32_t my_sense) {
+        Tree_Node& node = levels[level][index];
+        if (node.count.fetch_add(1) == node.expected - 1) {
+            if (level + 1 < levels.size()) {
+                arrive(level + 1, index / FAN_IN, my_sense);
+            }
+            node.count.store(0);
+            barrier_signal<Wait>(node.sense, my_sense);
+        } else {
+            barrier_wait_until<Wait>(node.sense, my_sense);
+        }
+    }
+
+public:
+    explicit Combining_Tree_Barrier(int num_threads) : states(num_threads) {
+        int width = num_threads;
+        do {
+            int nodes = (width + FAN_IN - 1) / FAN_IN;
+            levels.emplace_back(nodes);
+            for (int i = 0; i < width; ++i) {
+                ++levels.back()[i / FAN_IN].expected;
+            }
+            width = nodes;
+        } while (width > 1);
+    }
+
+    void wait(int id) {
+        uint32_t my_sense = states[id].sense;
+        states[id].sense ^= 1;
+        arrive(0, id / FAN_IN, my_sense);
+    }
+};
+
+/**
+ * @brief 3. Dissemination 배리어 (Hensgen, Finkel & Manber)
+ * 라운드 r마다 (id + 2^r) 번 스레드에게 신호를 보내고 자기 신호를 기다린다. ceil(log2 N) 라운드.
+ * 연속한 두 에피소드가 같은 플래그를 쓰지 않도록 parity로 두 벌을 번갈아 쓴다.
+ */
+template<Barrier_Wait Wait>
+class Dissemination_Barrier {
+    static constexpr int MAX_ROUNDS = 32;
+
+    struct alignas(64) Thread_Flags {
+        std::atomic<uint32_t> flags[2][MAX_ROUNDS] = {};
+    };
+
+    int num_threads;
+    int rounds = 0;
+    vector<Thread_Flags> flags;
+    vector<Barrier_Thread_State> states;
+public:
+    explicit Dissemination_Barrier(int num_threads) : num_threads(num_threads), flags(num_threads), states(num_threads) {
+        while ((1 << rounds) < num_threads) {
+            ++rounds;
+        }
+    }
+
+    void wait(int id) {
+        Barrier_Thread_State& state = states[id];
+        for (int r = 0; r < rounds; ++r) {
+            int partner = (id + (1 << r)) % num_threads;
+            barrier_signal<Wait>(flags[partner].flags[state.parity][r], state.sense);
+            barrier_wait_until<Wait>(flags[id].flags[state.parity][r], state.sense);
+        }
+        if (state.parity == 1) {
+            state.sense ^= 1;
+        }
+        state.parity ^= 1;
+    }
+};
+
+/**
+ * @brief 4. Tournament 배리어
+ * 라운드 r에서 id가 2^(r+1)의 배수인 스레드가 승자로 (id + 2^r)의 도착을 기다리고, 패자는 신호를 보낸 뒤
+ * 전역 release 플래그를 기다린다. 최종 승자(0번)가 release를 뒤집는다.
+ */
+template<Barrier_Wait Wait>
+class Tournament_Barrier {
+    static constexpr int MAX_ROUNDS = 32;
+
+    struct alignas(64) Thread_Flags {
+        std::atomic<uint32_t> arrived[MAX_ROUNDS] = {};
+    };
+
+    int num_threads;
+    vector<Thread_Flags> flags;
+    vector<Barrier_Thread_State> states;
+    alignas(64) std::atomic<uint32_t> release = 0;
+public:
+    explicit Tournament_Barrier(int num_threads) : num_threads(num_threads), flags(num_threads), states(num_threads) {}
+
+    void wait(int id) {
+        uint32_t my_sense = states[id].sense;
+        states[id].sense ^= 1;
+        for (int r = 0; (1 << r) < num_threads; ++r) {
+            int step = 1 << r;
+            if (id % (step * 2) != 0) {
+                barrier_signal<Wait>(flags[id - step].arrived[r], my_sense);
+                barrier_wait_until<Wait>(release, my_sense);
+                return;
+            }
+            if (id + step < num_threads) {
+                barrier_wait_until<Wait>(flags[id].arrived[r], my_sense);
+            }
+        }
+        barrier_signal<Wait>(release, my_sense);
+    }
+};
+
+/**
+ * @brief 5. std::barrier 래퍼 (비교 기준)
+ */
+class Std_Barrier {
+    std::barrier<> barrier;
+public:
+    explicit Std_Barrier(int num_threads) : barrier(num_threads) {}
+
+    void wait(int) {
+        barrier.arrive_and_wait();
+    }
+};
+
+/**
+ * @brief 스레드별 진행 에피소드 (false sharing 방지용 패딩)
+ */
+struct alignas(64) Barrier_Progress {
+    std::atomic<int> episode = 0;
+};
+
+/**
+ * @brief 배리어 스레드 작업 함수
+ * 에피소드마다 도착/통과 시각(tick)을 기록하고, 통과한 뒤 다른 모든 스레드가 같은 에피소드에
+ * 도착했는지 확인해 어긴 횟수를 센다.
+ */
+template<typename BarrierType>
+void barrier_worker_function(BarrierType& barrier, vector<Barrier_Progress>& progress, int id, long long& violations,
+                             vector<uint64_t>& arrivals, vector<uint64_t>& departures) {
+    long long local_violations = 0;
+    arrivals.resize(BARRIER_EPISODES);
+    departures.resize(BARRIER_EPISODES);
+    for (int episode = 1; episode <= BARRIER_EPISODES; ++episode) {
+        progress[id].episode.store(episode);
+        arrivals[episode - 1] = timer_now();
+        barrier.wait(id);
+        departures[episode - 1] = timer_now_end();
+        for (const auto& other : progress) {
+            if (other.episode.load() < episode) {
+                ++local_violations;
+            }
+        }
+    }
+    violations = local_violations;
+}
+
+/**
+ * @brief 배리어 실험 실행 및 결과 측정 (초당 에피소드, 마지막 도착부터 마지막 통과까지의 해제 지연)
+ */
+template<typename BarrierType>
+double run_barrier_experiment(const string& barrier_name, int num_threads) {
+
+    BarrierType barrier(num_threads);
+    vector<Barrier_Progress> progress(num_threads);
+    vector<long long> violations(num_threads, 0);
+    vector<vector<uint64_t>> arrivals(num_threads), departures(num_threads);
+    vector<thread> threads;
+
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        threads.emplace_back(barrier_worker_function<BarrierType>, ref(barrier), ref(progress), i, ref(violations[i]),
+                             ref(arrivals[i]), ref(departures[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] 배리어를 통과한 스레드가 뒤처진 스레드를 본 적이 없어야 한다
+    long long total_violations = 0;
+    for (long long v : violations) {
+        total_violations += v;
+    }
+
+    // 에피소드별 해제 지연: 마지막 스레드가 도착한 뒤 모든 스레드가 빠져나오기까지
+    vector<long long> release_latencies(BARRIER_EPISODES);
+    for (int episode = 0; episode < BARRIER_EPISODES; ++episode) {
+        uint64_t last_arrival = 0, last_departure = 0;
+        for (int i = 0; i < num_threads; ++i) {
+            last_arrival = max(last_arrival, arrivals[i][episode]);
+            last_departure = max(last_departure, departures[i][episode]);
+        }
+        release_latencies[episode] = timer_elapsed_ns(last_arrival, last_departure);
+    }
+
+    cout << barrier_name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << BARRIER_EPISODES / duration.count() << " episodes/s, ";
+    print_latency_summary("Release", release_latencies);
+    cout << ", Violations = " << total_violations;
+    cout << (total_violations == 0 ? " (Correct)" : " (Incorrect)") << endl;
+
+    return duration.count();
+}
+
+// ========= [14] 이벤트 카운트 (알림-깨어남 지연) =========
+
+constexpr int NOTIFY_HANDOFFS = 100'000; // 두 스레드가 주고받는 총 차례 수
+
+/**
+ * @brief 이벤트 카운트 (futex 기반 조건 알림)
+ * 대기자는 prepare_wait()로 현재 epoch를 받아 두고 조건을 다시 확인한 뒤 commit_wait()로 잠든다.
+ * notify()는 epoch를 올리고 대기자가 있을 때만 futex를 깨우므로, 알릴 대상이 없으면 시스템 콜이 없다.
+ */
+class Event_Count {
+    std::atomic<uint32_t> epoch = 0;
+    std::atomic<uint32_t> waiters = 0;
+public:
+    uint32_t prepare_wait() {
+        waiters.fetch_add(1);
+        return epoch.load();
+    }
+    void cancel_wait() {
+        waiters.fetch_sub(1);
+    }
+    void commit_wait(uint32_t key) {
+        while (epoch.load() == key) {
+            futex_wait(epoch, key);
+        }
+        waiters.fetch_sub(1);
+    }
+    void notify() {
+        epoch.fetch_add(1);
+        if (waiters.load() != 0) {
+            futex_wake(epoch, 1);
+        }
+    }
+    void notify_all() {
+        epoch.fetch_add(1);
+        if (waiters.load() != 0) {
+            futex_wake(epoch, INT32_MAX);
+        }
+    }
+};
+
+/**
+ * @brief 두 스레드가 번갈아 차례를 넘기는 채널 (이벤트 카운트)
+ */
+class Event_Count_Channel {
+    std::atomic<int> turn = 0;
+    Event_Count event_count;
+public:
+    void wait_for(int me) {
+        while (turn.load() != me) {
+            uint32_t key = event_count.prepare_wait();
+            if (turn.load() == me) {
+                event_count.cancel_wait();
+                break;
+            }
+            event_count.commit_wait(key);
+        }
+    }
+    void pass(int next) {
+        turn.store(next);
+        event_count.notify();
+    }
+};
+
+/**
+ * @brief 두 스레드가 번갈아 차례를 넘기는 채널 (std::condition_variable + std::mutex)
+ */
+class Condvar_Channel {
+    std::mutex mutex;
+    std::condition_variable cv;
+    int turn = 0;
+public:
+    void wait_for(int me) {
+        unique_lock<std::mutex> guard(mutex);
+        cv.wait(guard, [&] { return turn == me; });
+    }
+    void pass(int next) {
+        {
+            lock_guard<std::mutex> guard(mutex);
+            turn = next;
+        }
+        cv.notify_one();
+    }
+};
+
+/**
+ * @brief 스레드 배치 방식
+ */
+enum class Thread_Placement {
+    Unpinned,  // 스케줄러에 맡김
+    Same_CPU,  // 두 스레드 모두 허용된 첫 CPU
+    Cross_CPU  // 허용된 첫 CPU와 두 번째 CPU
+};
+
+/**
+ * @brief 알림 스레드 작업 함수
+ * 자기 차례를 기다렸다가, 상대가 알린 시각부터 깨어난 시각까지를 기록하고 차례를 넘긴다.
+ */
+template<typename Channel>
+void notify_worker_function(Channel& channel, int me, int cpu, std::atomic<uint64_t>& notified_at, long long& handoffs, vector<long long>& latencies, std::atomic<int>& pin_failures) {
+    if (cpu >= 0 && !pin_thread_to_cpu(cpu)) {
+        ++pin_failures;
+    }
+    latencies.reserve(NOTIFY_HANDOFFS / 2);
+    for (int i = 0; i < NOTIFY_HANDOFFS / 2; ++i) {
+        channel.wait_for(me);
+        uint64_t now = timer_now_end();
+        uint64_t sent = notified_at.load();
+        if (sent != 0) {
+            latencies.push_back(timer_elapsed_ns(sent, now));
+        }
+        ++handoffs; // 차례를 가진 스레드만 갱신
+        notified_at.store(timer_now());
+        channel.pass(1 - me);
+    }
+}
+
+/**
+ * @brief 알림 지연 실험 실행 및 결과 측정 (핑퐁 처리량, 알림-깨어남 지연)
+ */
+template<typename Channel>
+double run_notify_experiment(const string& channel_name, Thread_Placement placement, const vector<int>& allowed) {
+
+    Channel channel;
+    std::atomic<uint64_t> notified_at = 0;
+    long long handoffs = 0;
+    vector<long long> latencies[2];
+    std::atomic<int> pin_failures = 0;
+    int cpus[2] = {-1, -1};
+    if (placement == Thread_Placement::Same_CPU) {
+        cpus[0] = cpus[1] = allowed[0];
+    } else if (placement == Thread_Placement::Cross_CPU) {
+        cpus[0] = allowed[0];
+        cpus[1] = allowed[1];
+    }
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    for (int i = 0; i < 2; ++i) {
+        threads.emplace_back(notify_worker_function<Channel>, ref(channel), i, cpus[i], ref(notified_at), ref(handoffs), ref(latencies[i]), ref(pin_failures));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    latencies[0].insert(latencies[0].end(), latencies[1].begin(), latencies[1].end());
+
+    cout << channel_name << ": ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << NOTIFY_HANDOFFS / duration.count() / 1e3 << " Khandoffs/s, ";
+    print_latency_summary("Notify-to-Wake", latencies[0]);
+
+    // [**정확성 검증**] 차례가 정확히 NOTIFY_HANDOFFS번 넘어갔는지
+    bool is_correct = (handoffs == NOTIFY_HANDOFFS);
+    cout << ", Handoffs = " << handoffs << (is_correct ? " (Correct)" : " (Incorrect)") << endl;
+    if (pin_failures > 0) {
+        cout << "    Warning: " << pin_failures << " of 2 threads could not be pinned" << endl;
+    }
+
+    return duration.count();
+}
+
+// ========= [15] 코어당 스레드 (Shared-Nothing) =========
+
+constexpr size_t SPSC_QUEUE_CAPACITY = 1024; // 2의 거듭제곱
+
+/**
+ * @brief 단일 생산자 / 단일 소비자 링 버퍼 큐
+ * 생산자와 소비자는 상대 인덱스를 캐시해 두고, 큐가 가득 차거나 빈 것처럼 보일 때만 다시 읽는다.
+ */
+template<typename T>
+class SPSC_Queue {
+    alignas(64) std::atomic<size_t> head = 0; // 소비자만 쓴다
+    size_t cached_tail = 0;
+    alignas(64) std::atomic<size_t> tail = 0; // 생산자만 쓴다
+    size_t cached_head = 0;
+    alignas(64) T slots[SPSC_QUEUE_CAPACITY];
+public:
+    bool try_push(const T& value) {
+        size_t t = tail.load(std::memory_order_relaxed);
+        if (t - cached_head == SPSC_QUEUE_CAPACITY) {
+            cached_head = head.load(std::memory_order_acquire);
+            if (t - cached_head == SPSC_QUEUE_CAPACITY) {
+                return false;
+            }
+        }
+        slots[t % SPSC_QUEUE_CAPACITY] = value;
+        tail.store(t + 1, std::memory_order_release);
+        return true;
+    }
+    bool try_pop(T& value) {
+        size_t h = head.load(std::memory_order_relaxed);
+        if (h == cached_tail) {
+            cached_tail = tail.load(std::memory_order_acquire);
+            if (h == cached_tail) {
+                return false;
+            }
+        }
+        value = slots[h % SPSC_QUEUE_CAPACITY];
+        head.store(h + 1, std::memory_order_release);
+        return true;
+    }
+};
+
+/**
+ * @brief 샤드 (한 스레드만 쓰는 부분 합, false sharing 방지용 패딩)
+ */
+struct alignas(64) Counter_Shard {
+    long long sum = 0;
+};
+
+/**
+ * @brief Shared-Nothing 스레드 작업 함수
+ * 숫자 i는 (i % N)번 샤드의 몫이다. 자기 샤드 몫은 바로 더하고, 나머지는 주인 스레드의 SPSC 큐로 보낸다.
+ * 큐가 가득 차면 자기 수신 큐를 비우며 기다리므로 서로 막히지 않는다.
+ * queues[from * N + to]는 from -> to 방향 큐다.
+ * @param cpu 첫 연산 전에 고정할 CPU (-1이면 고정하지 않음)
+ */
+void shared_nothing_worker_function(vector<unique_ptr<SPSC_Queue<int>>>& queues, int me, int num_threads, int start_val, int end_val,
+                                    std::atomic<int>& producers_done, Counter_Shard& shard, int cpu, std::atomic<int>& pin_failures) {
+    if (cpu >= 0 && !pin_thread_to_cpu(cpu)) {
+        ++pin_failures;
+    }
+
+    long long local_sum = 0;
+    auto drain_inbox = [&] {
+        bool received = false;
+        int value;
+        for (int from = 0; from < num_threads; ++from) {
+            if (from == me) {
+                continue;
+            }
+            SPSC_Queue<int>& inbox = *queues[from * num_threads + me];
+            while (inbox.try_pop(value)) {
+                local_sum += value;
+                received = true;
+            }
+        }
+        return received;
+    };
+
+    for (int i = start_val; i <= end_val; ++i) {
+        int owner = i % num_threads;
+        if (owner == me) {
+            local_sum += i;
+            continue;
+        }
+        while (!queues[me * num_threads + owner]->try_push(i)) {
+            if (!drain_inbox()) {
+                this_thread::yield();
+            }
+        }
+    }
+    producers_done.fetch_add(1);
+
+    // 모든 생산자가 끝난 것을 본 뒤에도 받은 것이 없으면 수신 큐가 완전히 비었다
+    while (true) {
+        bool all_done = (producers_done.load() == num_threads);
+        bool received = drain_inbox();
+        if (all_done && !received) {
+            break;
+        }
+        if (!received) {
+            this_thread::yield();
+        }
+    }
+    shard.sum = local_sum;
+}
+
+/**
+ * @brief Shared-Nothing 실험 실행 및 결과 측정 (run_experiment와 같은 작업 분배와 정확성 검증)
+ */
+double run_shared_nothing_experiment(int num_threads) {
+
+    shared_counter = 0;
+    vector<unique_ptr<SPSC_Queue<int>>> queues(num_threads * num_threads);
+    for (auto& queue : queues) {
+        queue = make_unique<SPSC_Queue<int>>();
+    }
+    vector<Counter_Shard> shards(num_threads);
+    std::atomic<int> producers_done = 0;
+    std::atomic<int> pin_failures = 0;
+    // 스레드 i는 이 프로세스에 허용된 CPU 중 (i % 개수)번째에 고정한다
+    vector<int> cpus = allowed_cpus();
+
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+    vector<thread> threads;
+    auto start_time = timer_now();
+
+    int current_start = START_NUM;
+    for (int i = 0; i < num_threads; ++i) {
+        int range_size = NUM_OPERATIONS / num_threads + (i < NUM_OPERATIONS % num_threads ? 1 : 0);
+        int current_end = min(current_start + range_size - 1, END_NUM);
+        int cpu = cpus.empty() ? -1 : cpus[i % cpus.size()];
+        threads.emplace_back(shared_nothing_worker_function, ref(queues), i, num_threads, current_start, current_end, ref(producers_done), ref(shards[i]),
+                             cpu, ref(pin_failures));
+        current_start = current_end + 1;
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    for (const auto& shard : shards) {
+        shared_counter += shard.sum;
+    }
+
+    cout << "Shared-Nothing (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << NUM_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+
+    // [**정확성 검증**]
+    bool is_correct = (shared_counter == expected_result);
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+    if (pin_failures > 0) {
+        cout << "    Warning: " << pin_failures << " of " << num_threads << " threads could not be pinned" << endl;
+    }
+
+    return duration.count();
+}
+
+// ========= [16] M:N 사용자 수준 파이버 =========
+
+constexpr size_t FIBER_STACK_SIZE = 64 * 1024;
+constexpr int FIBER_YIELD_INTERVAL = 100; // 파이버가 이만큼 더할 때마다 양보 (여러 파이버가 실제로 섞여 돌도록)
+
+const vector<int> fiber_counts = {1'000, 4'000};
+
+/**
+ * @brief 파이버 (ucontext 문맥 + 전용 스택)
+ */
+struct Fiber {
+    ucontext_t context;
+    unique_ptr<char[]> stack;
+    function<void()> body;
+    bool done = false;
+};
+
+/**
+ * @brief M:N 파이버 스케줄러
+ * CPU마다 고정된 워커 스레드가 자기 실행 큐에서 파이버를 꺼내 돌리고, 큐가 비면 다른 워커에게서 훔친다.
+ * 파이버는 yield()로 워커 문맥으로 돌아가며, 워커가 문맥 저장이 끝난 파이버를 다시 큐에 넣는다.
+ */
+class Fiber_Scheduler {
+    struct alignas(64) Worker {
+        std::mutex lock;
+        deque<Fiber*> run_queue;
+        ucontext_t context;
+    };
+
+    vector<unique_ptr<Worker>> workers;
+    std::atomic<int> live_fibers = 0;
+    vector<int> cpus; // 워커 i는 cpus[i % 크기]에 고정 (이 프로세스에 허용된 CPU)
+    std::atomic<int> failed_pins = 0;
+
+    // 파이버는 다른 워커 스레드로 옮겨 다니므로, 컴파일러가 TLS 주소를 문맥 전환 너머로 캐시하지 못하게 한다
+    [[gnu::noinline]] static Worker*& current_worker() {
+        thread_local Worker* worker = nullptr;
+        return worker;
+    }
+    [[gnu::noinline]] static Fiber*& current_fiber() {
+        thread_local Fiber* fiber = nullptr;
+        return fiber;
+    }
+
+    static void fiber_entry() {
+        Fiber* fiber = current_fiber();
+        fiber->body();
+        fiber->done = true;
+        setcontext(&current_worker()->context);
+    }
+
+    Fiber* take_fiber(int index) {
+        for (size_t i = 0; i < workers.size(); ++i) {
+            Worker& victim = *workers[(index + i) % workers.size()];
+            lock_guard<std::mutex> guard(victim.lock);
+            if (!victim.run_queue.empty()) {
+                Fiber* fiber;
+                if (i == 0) {
+                    fiber = victim.run_queue.front();
+                    victim.run_queue.pop_front();
+                } else {
+                    fiber = victim.run_queue.back(); // 훔칠 때는 반대쪽 끝에서
+                    victim.run_queue.pop_back();
+                }
+                return fiber;
+            }
+        }
+        return nullptr;
+    }
+
+    void worker_loop(int index) {
+        if (!cpus.empty() && !pin_thread_to_cpu(cpus[index % cpus.size()])) {
+            ++failed_pins;
+        }
+        Worker& worker = *workers[index];
+        current_worker() = &worker;
+
+        while (true) {
+            Fiber* fiber = take_fiber(index);
+            if (fiber == nullptr) {
+                if (live_fibers.load() == 0) {
+                    break;
+                }
+                this_thread::yield();
+                continue;
+            }
+            current_fiber() = fiber;
+            swapcontext(&worker.context, &fiber->context);
+
+            if (fiber->done) {
+                delete fiber;
+                live_fibers.fetch_sub(1);
+            } else {
+                lock_guard<std::mutex> guard(worker.lock);
+                worker.run_queue.push_back(fiber);
+            }
+        }
+    }
+
+public:
+    explicit Fiber_Scheduler(int num_workers) : cpus(allowed_cpus()) {
+        for (int i = 0; i < num_workers; ++i) {
+            workers.push_back(make_unique<Worker>());
+        }
+    }
+
+    /**
+     * @brief 파이버를 만들어 워커들에게 번갈아 배정한다 (run() 전에 호출)
+     */
+    void spawn(function<void()> body) {
+        Fiber* fiber = new Fiber;
+        fiber->body = std::move(body);
+        fiber->stack.reset(new char[FIBER_STACK_SIZE]);
+        getcontext(&fiber->context);
+        fiber->context.uc_stack.ss_sp = fiber->stack.get();
+        fiber->context.uc_stack.ss_size = FIBER_STACK_SIZE;
+        fiber->context.uc_link = nullptr;
+        makecontext(&fiber->context, fiber_entry, 0);
+
+        Worker& worker = *workers[live_fibers.fetch_add(1) % workers.size()];
+        lock_guard<std::mutex> guard(worker.lock);
+        worker.run_queue.push_back(fiber);
+    }
+
+    /**
+     * @brief 워커 스레드를 띄워 모든 파이버가 끝날 때까지 실행한다
+     */
+    void run() {
+        vector<thread> threads;
+        for (size_t i = 0; i < workers.size(); ++i) {
+            threads.emplace_back(&Fiber_Scheduler::worker_loop, this, int(i));
+        }
+        for (auto& t : threads) {
+            t.join();
+        }
+    }
+
+    int pin_failures() const { return failed_pins.load(); }
+
+    /**
+     * @brief 현재 파이버를 실행 큐 뒤로 보내고 다른 파이버에게 워커를 넘긴다
+     */
+    static void yield() {
+        swapcontext(&current_fiber()->context, &current_worker()->context);
+    }
+};
+
+/**
+ * @brief 16. Fiber-Yielding Lock 구현
+ * 경합 시 스핀하거나 futex로 잠들지 않고, 같은 워커의 다른 파이버로 전환한다.
+ * 단, glibc swapcontext는 전환마다 시그널 마스크를 저장/복원하느라 rt_sigprocmask 시스템 호출을 한 번씩 한다.
+ */
+class Fiber_Lock {
+    std::atomic<bool> locked = false;
+public:
+    void lock() {
+        while (locked.load() || locked.exchange(true)) {
+            Fiber_Scheduler::yield();
+        }
+    }
+    void unlock() {
+        locked.store(false);
+    }
+};
+
+/**
+ * @brief 파이버 작업 함수 (Fiber_Lock으로 공유 카운터에 합산, 주기적으로 양보)
+ */
+void fiber_worker_function(Fiber_Lock& lock_instance, long long& counter, int start_val, int end_val) {
+    for (int i = start_val; i <= end_val; ++i) {
+        lock_instance.lock();
+        counter += i; // Critical Section
+        lock_instance.unlock();
+        if ((i - start_val) % FIBER_YIELD_INTERVAL == FIBER_YIELD_INTERVAL - 1) {
+            Fiber_Scheduler::yield();
+        }
+    }
+}
+
+/**
+ * @brief 파이버 실험 실행 및 결과 측정 (run_experiment와 같은 작업 분배와 정확성 검증)
+ */
+double run_fiber_experiment(int num_fibers, int num_workers) {
+
+    shared_counter = 0;
+    Fiber_Lock lock_instance;
+    Fiber_Scheduler scheduler(num_workers);
+
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long expected_result = sum_to_end - sum_to_start_minus_1;
+
+    auto start_time = timer_now();
+
+    int current_start = START_NUM;
+    for (int i = 0; i < num_fibers; ++i) {
+        int range_size = NUM_OPERATIONS / num_fibers + (i < NUM_OPERATIONS % num_fibers ? 1 : 0);
+        int current_end = min(current_start + range_size - 1, END_NUM);
+        scheduler.spawn([&lock_instance, current_start, current_end] {
+            fiber_worker_function(lock_instance, shared_counter, current_start, current_end);
+        });
+        current_start = current_end + 1;
+    }
+    scheduler.run();
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    cout << "Fiber Lock (" << num_fibers << " fibers on " << num_workers << " workers): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+
+    // [**정확성 검증**]
+    bool is_correct = (shared_counter == expected_result);
+    cout << "Final Sum = " << shared_counter;
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(shared_counter - expected_result);
+    }
+    cout << endl;
+    if (scheduler.pin_failures() > 0) {
+        cout << "    Warning: " << scheduler.pin_failures() << " of " << num_workers << " workers could not be pinned" << endl;
+    }
+
+    return duration.count();
+}
+
+// ========= [17] 안전한 메모리 회수 (Hazard Pointers / EBR) =========
+
+constexpr int RECLAIM_OPERATIONS = 2'000'000;      // 총 enqueue/dequeue(push/pop) 연산 횟수
+
+/**
+ * @brief Michael-Scott Lock-free Queue (회수 방식을 템플릿으로 받는다)
+ * head는 항상 더미 노드를 가리키며, dequeue는 더미 다음 노드의 값을 꺼내고 옛 더미를 retire한다.
+ */
+template<Reclamation_Scheme Reclaimer>
+class MS_Queue {
+    alignas(64) std::atomic<Reclaim_Node*> head;
+    alignas(64) std::atomic<Reclaim_Node*> tail;
+    Reclaimer reclaimer;
+public:
+    explicit MS_Queue(int num_threads) : reclaimer(num_threads) {
+        Reclaim_Node* dummy = new Reclaim_Node{0};
+        head.store(dummy);
+        tail.store(dummy);
+    }
+    ~MS_Queue() {
+        for (Reclaim_Node* node = head.load(); node != nullptr;) {
+            Reclaim_Node* next = node->next.load();
+            delete node;
+            node = next;
+        }
+    }
+
+    const Reclaim_Stats& stats() const { return reclaimer.stats; }
+
+    void push(int tid, long long value) {
+        Reclaim_Node* node = new Reclaim_Node{value};
+        reclaimer.enter(tid);
+        while (true) {
+            Reclaim_Node* last = reclaimer.protect(tid, 0, tail);
+            Reclaim_Node* next = last->next.load();
+            if (last != tail.load()) {
+                continue;
+            }
+            if (next == nullptr) {
+                if (last->next.compare_exchange_weak(next, node)) {
+                    tail.compare_exchange_strong(last, node);
+                    break;
+                }
+            } else {
+                tail.compare_exchange_strong(last, next); // 뒤처진 tail을 도와서 전진
+            }
+        }
+        reclaimer.leave(tid);
+    }
+
+    bool pop(int tid, long long& value) {
+        reclaimer.enter(tid);
+        while (true) {
+            Reclaim_Node* first = reclaimer.protect(tid, 0, head);
+            Reclaim_Node* last = tail.load();
+            Reclaim_Node* next = reclaimer.protect(tid, 1, first->next);
+            if (first != head.load()) {
+                continue;
+            }
+            if (next == nullptr) {
+                reclaimer.leave(tid);
+                return false;
+            }
+            if (first == last) {
+                tail.compare_exchange_strong(last, next);
+                continue;
+            }
+            value = next->value;
+            if (head.compare_exchange_weak(first, next)) {
+                reclaimer.retire(tid, first);
+                reclaimer.leave(tid);
+                return true;
+            }
+        }
+    }
+};
+
+struct Reclaim_Thread_Result {
+    long long pushes = 0;
+    long long pops = 0;
+};
+
+/**
+ * @brief 회수 실험 스레드 작업 함수 (push/pop 50:50)
+ */
+template<typename Structure>
+void reclaim_worker_function(Structure& structure, int tid, int num_ops, Reclaim_Thread_Result& result) {
+    std::minstd_rand rng(tid + 1);
+    long long value;
+    // 결과 배열의 이웃 원소와 캐시 라인을 공유하므로 지역 변수에 세고 끝에 한 번만 기록한다
+    long long pushes = 0;
+    long long pops = 0;
+    for (int i = 0; i < num_ops; ++i) {
+        if (rng() % 2 == 0) {
+            structure.push(tid, i);
+            ++pushes;
+        } else if (structure.pop(tid, value)) {
+            ++pops;
+        }
+    }
+    result.pushes = pushes;
+    result.pops = pops;
+}
+
+/**
+ * @brief 회수 실험 실행 및 결과 측정 (처리량, 미해제 최고치, 회수 지연)
+ */
+template<template<typename> class Structure, typename Reclaimer>
+double run_reclaim_experiment(const string& name, int num_threads) {
+
+    Structure<Reclaimer> structure(num_threads);
+    vector<Reclaim_Thread_Result> results(num_threads);
+    vector<thread> threads;
+
+    auto start_time = timer_now();
+
+    for (int i = 0; i < num_threads; ++i) {
+        int num_ops = RECLAIM_OPERATIONS / num_threads + (i < RECLAIM_OPERATIONS % num_threads ? 1 : 0);
+        threads.emplace_back(reclaim_worker_function<Structure<Reclaimer>>, ref(structure), i, num_ops, ref(results[i]));
+    }
+
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    auto end_time = timer_now_end();
+    chrono::duration<double> duration = timer_elapsed(start_time, end_time);
+
+    // [**정확성 검증**] push 수 - pop 성공 수 = 남은 노드 수
+    long long pushes = 0, pops = 0;
+    for (const auto& r : results) {
+        pushes += r.pushes;
+        pops += r.pops;
+    }
+    long long remaining = 0, value;
+    while (structure.pop(0, value)) {
+        ++remaining;
+    }
+
+    cout << name << " (" << num_threads << " threads): ";
+    cout << "Time = " << duration.count() * 1000 << " ms, ";
+    cout << "Throughput = " << RECLAIM_OPERATIONS / duration.count() / 1e6 << " Mops/s, ";
+    structure.stats().report();
+    cout << "Remaining = " << remaining;
+
+    bool is_correct = (pushes - pops == remaining);
+    cout << (is_correct ? " (Correct)" : " (Incorrect)");
+    if (!is_correct) {
+        cout << ", Error = " << abs(pushes - pops - remaining);
+    }
+    cout << endl;
+
+    return duration.count();
+}
+
+// ========= [18] 확장성 모델 적합 (Amdahl / USL) =========
+
+/**
+ * @brief 확장성 모델 파라미터
+ * USL: X(N) = lambda * N / (1 + sigma * (N - 1) + kappa * N * (N - 1)), Amdahl은 kappa = 0인 경우.
+ */
+struct Scalability_Fit {
+    double lambda = 0; // 스레드 1개 처리량 (ops/s)
+    double sigma = 0;  // 경합 (직렬화) 계수
+    double kappa = 0;  // 일관성 (crosstalk) 계수
+
+    double predict(double n) const {
+        return lambda * n / (1 + sigma * (n - 1) + kappa * n * (n - 1));
+    }
+};
+
+/**
+ * @brief USL (또는 use_kappa = false면 Amdahl) 최소제곱 적합 (Gunther의 방법)
+ * lambda는 스레드 1개 측정값으로 고정하고, 상대 용량 C(N) = X(N) / lambda에 대해
+ * N / C(N) - 1 = sigma (N - 1) + kappa N (N - 1) 을 절편 없이 선형 회귀한다.
+ * 스레드 1개 측정값이 없으면 빈 결과를 돌려준다.
+ */
+Scalability_Fit fit_scalability(const vector<pair<int, double>>& samples, bool use_kappa) {
+    Scalability_Fit fit;
+    for (const auto& [n, throughput] : samples) {
+        if (n == 1) {
+            fit.lambda = throughput;
+        }
+    }
+    if (fit.lambda <= 0) {
+        return {};
+    }
+
+    // 정규방정식 [sxx sxz; sxz szz] [sigma; kappa] = [sxy; szy]  (x = N - 1, z = N (N - 1))
+    double sxx = 0, sxz = 0, szz = 0, sxy = 0, szy = 0;
+    for (const auto& [n, throughput] : samples) {
+        double x = n - 1;
+        double z = double(n) * (n - 1);
+        double y = n / (throughput / fit.lambda) - 1;
+        sxx += x * x;
+        sxz += x * z;
+        szz += z * z;
+        sxy += x * y;
+        szy += z * y;
+    }
+    if (!use_kappa) {
+        fit.sigma = sxx > 0 ? sxy / sxx : 0;
+        return fit;
+    }
+    double determinant = sxx * szz - sxz * sxz;
+    if (determinant == 0) {
+        return fit;
+    }
+    fit.sigma = (sxy * szz - szy * sxz) / determinant;
+    fit.kappa = (sxx * szy - sxz * sxy) / determinant;
+    return fit;
+}
+
+/**
+ * @brief 적합 결과와 측정값 대비 잔차 출력
+ */
+void report_scalability(const string& lock_name, const vector<pair<int, double>>& samples, int predict_threads) {
+    Scalability_Fit amdahl = fit_scalability(samples, false);
+    Scalability_Fit usl = fit_scalability(samples, true);
+
+    cout << lock_name << " Amdahl: lambda = " << amdahl.lambda / 1e6 << " Mops/s, sigma = " << amdahl.sigma;
+    if (amdahl.sigma > 0) {
+        cout << ", max speedup = " << 1.0 / amdahl.sigma;
+    }
+    cout << endl;
+
+    cout << lock_name << " USL: lambda = " << usl.lambda / 1e6 << " Mops/s, sigma = " << usl.sigma << ", kappa = " << usl.kappa;
+    if (usl.kappa > 0 && usl.sigma < 1) {
+        double peak = sqrt((1 - usl.sigma) / usl.kappa);
+        cout << ", peak at N = " << peak << " (" << usl.predict(peak) / 1e6 << " Mops/s)";
+    } else if (usl.sigma >= 1) {
+        cout << ", no peak (throughput falls from N = 1)";
+    } else {
+        cout << ", no peak (kappa <= 0)";
+    }
+    cout << ", predicted X(" << predict_threads << ") = " << usl.predict(predict_threads) / 1e6 << " Mops/s" << endl;
+
+    cout << "    Residuals (N: measured / Amdahl / USL Mops/s):";
+    double usl_squared_error = 0;
+    for (const auto& [n, throughput] : samples) {
+        cout << " " << n << ": " << throughput / 1e6 << "/" << amdahl.predict(n) / 1e6 << "/" << usl.predict(n) / 1e6 << ";";
+        double relative = (usl.predict(n) - throughput) / throughput;
+        usl_squared_error += relative * relative;
+    }
+    cout << " USL RMS error = " << 100 * sqrt(usl_squared_error / samples.size()) << "%" << endl;
+}
+
+// ========= [19] 코어 간 캐시 라인 전송 지연 (c2c) =========
+
+constexpr int C2C_ROUND_TRIPS = 10'000; // 배치당 왕복 횟수
+constexpr int C2C_BATCHES = 5;          // 중앙값을 취할 배치 수
+
+/**
+ * @brief 캐시 라인 하나를 두 CPU가 주고받는 핑퐁 상태
+ */
+struct alignas(64) C2C_Line {
+    std::atomic<int> flag = 0;
+};
+
+constexpr int C2C_ABORT = -1; // 고정 실패 시 응답 스레드를 돌려보내는 flag 값
+
+/**
+ * @brief 순수 스핀 대기용 pause (yield 없이 캐시 라인만 기다린다)
+ */
+inline void c2c_pause() {
+#if defined(__x86_64__)
+    _mm_pause();
+#endif
+}
+
+/**
+ * @brief 응답 스레드 작업 함수
+ * TTAS_Lock처럼 읽기로만 스핀하다가 1을 보면 0으로 되돌려 라인을 넘긴다. yield하지 않으므로
+ * 두 스레드가 서로 다른 CPU에 고정된 경우에만 돌린다 (측정 스레드가 C2C_ABORT로 돌려보낸다).
+ */
+void c2c_responder_function(C2C_Line& line, int cpu, std::atomic<int>& ready, std::atomic<bool>& pinned) {
+    pinned.store(pin_thread_to_cpu(cpu));
+    ready.fetch_add(1);
+    for (int i = 0; i < C2C_ROUND_TRIPS * C2C_BATCHES; ++i) {
+        int flag;
+        while ((flag = line.flag.load(std::memory_order_acquire)) == 0) {
+            c2c_pause();
+        }
+        if (flag == C2C_ABORT) {
+            return;
+        }
+        line.flag.store(0, std::memory_order_release);
+    }
+}
+
+/**
+ * @brief cpu_a와 cpu_b 사이의 편도 캐시 라인 전송 지연 (ns)
+ * 배치마다 왕복 시간 / 2를 구해 중앙값을 돌려준다. 고정에 실패하면 -1.
+ * 측정 스레드의 원래 affinity (taskset/cpuset으로 받은 마스크)는 끝나고 되돌린다.
+ */
+double measure_c2c_latency(int cpu_a, int cpu_b) {
+    cpu_set_t original_mask;
+    pthread_getaffinity_np(pthread_self(), sizeof(original_mask), &original_mask);
+
+    C2C_Line line;
+    std::atomic<int> ready = 0;
+    std::atomic<bool> responder_pinned = false;
+    thread responder(c2c_responder_function, ref(line), cpu_b, ref(ready), ref(responder_pinned));
+
+    bool pinned = pin_thread_to_cpu(cpu_a);
+    spin_until([&] { return ready.load() == 1; });
+    pinned = pinned && responder_pinned.load();
+
+    vector<double> batches;
+    if (pinned) {
+        for (int batch = 0; batch < C2C_BATCHES; ++batch) {
+            auto start_time = timer_now();
+            for (int i = 0; i < C2C_ROUND_TRIPS; ++i) {
+                line.flag.store(1, std::memory_order_release);
+                while (line.flag.load(std::memory_order_acquire) != 0) {
+                    c2c_pause();
+                }
+            }
+            auto end_time = timer_now_end();
+            batches.push_back(double(timer_elapsed_ns(start_time, end_time)) / C2C_ROUND_TRIPS / 2);
+        }
+    } else {
+        line.flag.store(C2C_ABORT, std::memory_order_release);
+    }
+    responder.join();
+
+    pthread_setaffinity_np(pthread_self(), sizeof(original_mask), &original_mask);
+
+    if (!pinned) {
+        return -1;
+    }
+    sort(batches.begin(), batches.end());
+    return batches[C2C_BATCHES / 2];
+}
+
+/**
+ * @brief 모든 CPU 쌍의 전송 지연 행렬 (대각선은 0, 측정 실패는 -1)
+ */
+vector<vector<double>> measure_c2c_matrix(int num_cpus) {
+    vector<vector<double>> matrix(num_cpus, vector<double>(num_cpus, 0));
+    for (int a = 0; a < num_cpus; ++a) {
+        for (int b = a + 1; b < num_cpus; ++b) {
+            // 코히어런스 전송은 방향과 무관하다고 보고 한 번만 잰다
+            matrix[a][b] = matrix[b][a] = measure_c2c_latency(a, b);
+        }
+    }
+    return matrix;
+}
+
+/**
+ * @brief 지연 행렬과 대각선 밖 최소/평균/최대 출력
+ */
+void print_c2c_matrix(const vector<vector<double>>& matrix) {
+    int num_cpus = matrix.size();
+    cout << "One-way latency (ns):" << endl;
+    cout << setw(6) << "CPU";
+    for (int b = 0; b < num_cpus; ++b) {
+        cout << setw(8) << b;
+    }
+    cout << endl;
+
+    double minimum = 0, maximum = 0, total = 0;
+    int count = 0;
+    for (int a = 0; a < num_cpus; ++a) {
+        cout << setw(6) << a;
+        for (int b = 0; b < num_cpus; ++b) {
+            if (a == b) {
+                cout << setw(8) << "-";
+            } else if (matrix[a][b] < 0) {
+                cout << setw(8) << "n/a";
+            } else {
+                cout << setw(8) << fixed << setprecision(1) << matrix[a][b] << defaultfloat << setprecision(6);
+                minimum = count == 0 ? matrix[a][b] : min(minimum, matrix[a][b]);
+                maximum = max(maximum, matrix[a][b]);
+                total += matrix[a][b];
+                ++count;
+            }
+        }
+        cout << endl;
+    }
+    if (count > 0) {
+        cout << "Min = " << minimum << " ns, Mean = " << total / count << " ns, Max = " << maximum << " ns" << endl;
+    } else {
+        cout << "No CPU pairs measured" << endl;
+    }
+}
+
+/**
+ * @brief 고정 배치에서 기대되는 락 인계 한 번의 전송 비용 (ns)
+ * 스레드 i는 cpus[i % 크기]에서 돈다. 다음 보유자가 나머지 스레드 중 균등하게 정해진다고 보고
+ * 순서쌍 평균을 낸다 (같은 CPU끼리는 0). 측정값이 없으면 -1.
+ */
+double expected_handoff_ns(const vector<vector<double>>& matrix, const vector<int>& cpus, int num_threads) {
+    double total = 0;
+    long long pairs = 0;
+    for (int i = 0; i < num_threads; ++i) {
+        for (int j = 0; j < num_threads; ++j) {
+            if (i == j) {
+                continue;
+            }
+            int a = cpus[i % cpus.size()];
+            int b = cpus[j % cpus.size()];
+            if (a >= int(matrix.size()) || b >= int(matrix.size()) || matrix[a][b] < 0) {
+                return -1;
+            }
+            total += a == b ? 0 : matrix[a][b];
+            ++pairs;
+        }
+    }
+    return pairs > 0 ? total / pairs : -1;
+}
+
+/**
+ * @brief 락 결과에 기대 인계 비용 주석 달기
+ */
+void report_expected_handoff(const vector<vector<double>>& matrix, int num_threads, double duration) {
+    double measured = duration * 1e9 / NUM_OPERATIONS;
+    double expected = g_pin_failures > 0 ? -1 : expected_handoff_ns(matrix, g_pinned_cpus, num_threads);
+    cout << "    Expected Handoff = ";
+    if (g_pin_failures > 0) {
+        cout << "n/a (threads not pinned)";
+    } else if (expected < 0) {
+        cout << "n/a";
+    } else {
+        cout << expected << " ns";
+    }
+    cout << ", Measured = " << measured << " ns/op";
+    if (expected > 0) {
+        cout << " (transfer ~" << 100 * expected / measured << "% of op time)";
+    }
+    cout << endl;
+}
+
+
+// =================================================
+
+/**
+ * @brief 공유 카운터 합산 실험 (기본 모드, 옵션: --sockets=N 이면 스레드를 N개의 가상 소켓에 나눠 배정)
+ * --sample-ms=N 이면 run_experiment를 쓰는 모든 모드에서 N ms 간격 처리량 시계열을 함께 출력한다.
+ */
+void run_counter_benchmark() {
+    g_virtual_sockets = option_value("sockets", 0);
+
+    // 정답을 미리 출력 (1,000,000 부터 5,000,000 까지의 합)
+    long long sum_to_end = (long long)END_NUM * (END_NUM + 1) / 2;
+    long long sum_to_start_minus_1 = (long long)(START_NUM - 1) * START_NUM / 2;
+    long long true_expected_result = sum_to_end - sum_to_start_minus_1;
+
+    cout << "===== Lock Mechanism Performance Evaluation =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+    cout << "True Expected Result (Final Sum): " << true_expected_result << endl;
+    if (g_virtual_sockets > 0) {
+        cout << "Virtual Sockets: " << g_virtual_sockets << endl;
+    }
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+        
+        // 1. No Lock
+        run_experiment<TAS_Lock>("No Lock", num_threads, false);
+
+        // 2. TAS Lock
+        run_experiment<TAS_Lock>("TAS Lock", num_threads);
+        
+        // 3. TTAS Lock
+        run_experiment<TTAS_Lock>("TTAS Lock", num_threads);
+
+        // 4. Backoff Lock
+        run_experiment<Backoff_Lock>("Backoff Lock", num_threads);
+
+        // 5. Per-CPU Counter (rseq)
+        run_per_cpu_experiment(num_threads);
+
+        // 6. Parking Lot Lock
+        run_experiment<Parking_Lot_Lock>("Parking Lot Lock", num_threads);
+
+        // 7. Queue Locks (소켓 간 전달 횟수 함께 측정)
+        run_experiment<Handoff_Counted_Lock<Ticket_Lock>>("Ticket Lock", num_threads);
+        report_handoff_stats();
+        run_experiment<Handoff_Counted_Lock<MCS_Lock>>("MCS Lock", num_threads);
+        report_handoff_stats();
+        run_experiment<Handoff_Counted_Lock<CNA_Lock>>("CNA Lock", num_threads);
+        report_handoff_stats();
+
+        // 8. Shared-Nothing (코어당 스레드 + SPSC 메시지 전달)
+        run_shared_nothing_experiment(num_threads);
+    }
+}
+
+/**
+ * @brief 스택 push/pop 혼합 실험 (mode: stack, 옵션: --push-ratio=50)
+ */
+void run_stack_benchmark() {
+    int push_percent = option_value("push-ratio", 50);
+
+    cout << "===== Concurrent Stack Performance Evaluation =====" << endl;
+    cout << "Operations: " << STACK_OPERATIONS << " (push " << push_percent << "%, pop " << 100 - push_percent << "%)" << endl;
+    cout << "Node Allocator: " << (g_use_node_pool ? "per-thread slab pool" : "system") << ", Lock-free Reclamation: EBR" << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_stack_experiment<Locked_Stack<TAS_Lock>>("TAS Lock Stack", num_threads, push_percent);
+        run_stack_experiment<Locked_Stack<TTAS_Lock>>("TTAS Lock Stack", num_threads, push_percent);
+        run_stack_experiment<Locked_Stack<Backoff_Lock>>("Backoff Lock Stack", num_threads, push_percent);
+        run_stack_experiment<Treiber_Stack<Epoch_Reclamation>>("Treiber Stack", num_threads, push_percent);
+        run_stack_experiment<Elimination_Stack<Epoch_Reclamation>>("Elimination Stack", num_threads, push_percent);
+    }
+}
+
+/**
+ * @brief Skip List 집합 실험 (mode: set)
+ */
+void run_set_benchmark() {
+    Set_Workload workload;
+    workload.key_range = option_value("key-range", workload.key_range);
+    workload.insert_percent = option_value("insert", workload.insert_percent);
+    workload.delete_percent = option_value("delete", workload.delete_percent);
+    workload.range_percent = option_value("range", workload.range_percent);
+    workload.range_length = option_value("range-length", workload.range_length);
+
+    cout << "===== Concurrent Ordered Set (Skip List) Performance Evaluation =====" << endl;
+    cout << "Operations: " << SET_OPERATIONS << ", Key Range: [0, " << workload.key_range << ")" << endl;
+    cout << "Node Allocator: " << (g_use_node_pool ? "per-thread slab pool" : "system") << endl;
+    cout << "Mix: insert " << workload.insert_percent << "%, delete " << workload.delete_percent
+         << "%, range " << workload.range_percent << "% (length " << workload.range_length << "), lookup "
+         << 100 - workload.insert_percent - workload.delete_percent - workload.range_percent << "%" << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_set_experiment<Lazy_Skip_List<TAS_Lock>>("TAS Lock Lazy Skip List", num_threads, workload);
+        run_set_experiment<Lazy_Skip_List<TTAS_Lock>>("TTAS Lock Lazy Skip List", num_threads, workload);
+        run_set_experiment<Lazy_Skip_List<Backoff_Lock>>("Backoff Lock Lazy Skip List", num_threads, workload);
+        run_set_experiment<Lock_Free_Skip_List>("Lock-free Skip List", num_threads, workload);
+    }
+}
+
+/**
+ * @brief 계좌 이체 실험 (mode: bank, 옵션: --accounts=N 으로 계좌 수 고정)
+ */
+void run_bank_benchmark() {
+    vector<int> counts = account_counts;
+    if (g_options.count("accounts")) {
+        counts = {max(2, int(option_value("accounts", 2)))}; // 이체에는 서로 다른 두 계좌가 필요하다
+    }
+
+    cout << "===== Bank Transfer (Two-Lock) Performance Evaluation =====" << endl;
+    cout << "Transfers: " << TRANSFER_OPERATIONS << ", Initial Balance per Account: " << INITIAL_BALANCE << endl;
+
+    for (int num_accounts : counts) {
+        cout << "\n===== " << num_accounts << " Accounts =====" << endl;
+        for (int num_threads : thread_counts) {
+            cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+            run_bank_experiment<TAS_Lock>("TAS Lock", num_threads, num_accounts);
+            run_bank_experiment<TTAS_Lock>("TTAS Lock", num_threads, num_accounts);
+            run_bank_experiment<Backoff_Lock>("Backoff Lock", num_threads, num_accounts);
+        }
+    }
+}
+
+/**
+ * @brief STM과 락 비교 실험 (mode: stm)
+ * 카운터, 계좌 이체, 해시 맵 워크로드를 TAS/TTAS 락과 TL2 STM으로 각각 실행한다.
+ * 옵션: --accounts=1024, --key-range=65536, --update=20
+ */
+void run_stm_benchmark() {
+    int num_accounts = max(2, int(option_value("accounts", 1024)));
+    int key_range = option_value("key-range", 1 << 16);
+    int update_percent = option_value("update", 20);
+
+    cout << "===== Software Transactional Memory (TL2) vs Locks =====" << endl;
+    cout << "Counter: " << NUM_OPERATIONS << " increments, Bank: " << TRANSFER_OPERATIONS << " transfers over "
+         << num_accounts << " accounts, Hash Map: " << HASH_MAP_OPERATIONS << " ops (update " << update_percent
+         << "%, key range " << key_range << ")" << endl;
+    cout << "Node Allocator: " << (g_use_node_pool ? "per-thread slab pool" : "system") << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        cout << "[Counter]" << endl;
+        run_experiment<TAS_Lock>("TAS Lock", num_threads);
+        run_experiment<TTAS_Lock>("TTAS Lock", num_threads);
+        run_stm_counter_experiment(num_threads);
+
+        cout << "[Bank Transfer]" << endl;
+        run_bank_experiment<TAS_Lock>("TAS Lock", num_threads, num_accounts);
+        run_bank_experiment<TTAS_Lock>("TTAS Lock", num_threads, num_accounts);
+        run_stm_bank_experiment(num_threads, num_accounts);
+
+        cout << "[Hash Map]" << endl;
+        run_hash_map_experiment<Locked_Hash_Map<TAS_Lock>>("TAS Lock", num_threads, key_range, update_percent);
+        run_hash_map_experiment<Locked_Hash_Map<TTAS_Lock>>("TTAS Lock", num_threads, key_range, update_percent);
+        run_hash_map_experiment<STM_Hash_Map>("TL2 STM", num_threads, key_range, update_percent);
+        report_stm_stats();
+    }
+}
+
+/**
+ * @brief 읽기 위주 실험 (mode: read, 옵션: --write=5)
+ * 중앙 집중형 RW Spin Lock과 CPU별 reader 슬롯을 쓰는 BR Lock의 reader 확장성을 비교한다.
+ */
+void run_read_mostly_benchmark() {
+    int write_percent = option_value("write", 5);
+
+    cout << "===== Read-Mostly Lock Performance Evaluation =====" << endl;
+    cout << "Operations: " << READ_MOSTLY_OPERATIONS << " (read " << 100 - write_percent << "%, write " << write_percent << "%)" << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_read_mostly_experiment<TTAS_Lock>("TTAS Lock", num_threads, write_percent);
+        run_read_mostly_experiment<RW_Spin_Lock>("RW Spin Lock", num_threads, write_percent);
+        run_read_mostly_experiment<Opt_Lock>("Optimistic Lock", num_threads, write_percent);
+        run_read_mostly_experiment<BR_Lock<BR_Slot_Policy::Per_CPU>>("BR Lock (per-CPU)", num_threads, write_percent);
+        run_read_mostly_experiment<BR_Lock<BR_Slot_Policy::Per_Thread>>("BR Lock (per-thread)", num_threads, write_percent);
+    }
+}
+
+/**
+ * @brief 코루틴 비동기 락 실험 (mode: async, 옵션: --executor-threads=2)
+ * 같은 논리적 동시성(코루틴 수 = 스레드 수)에서 블로킹 락과 비교한다.
+ */
+void run_async_benchmark() {
+    int num_executor_threads = max(1, int(option_value("executor-threads", 2)));
+
+    cout << "===== Coroutine Async Mutex Performance Evaluation =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+    cout << "Executor Threads: " << num_executor_threads << endl;
+
+    for (int concurrency : thread_counts) {
+        cout << "\n--- Logical Concurrency " << concurrency << " ---" << endl;
+
+        run_async_experiment(concurrency, num_executor_threads);
+        run_experiment<std::mutex>("std::mutex", concurrency);
+        run_experiment<TTAS_Lock>("TTAS Lock", concurrency);
+    }
+}
+
+/**
+ * @brief 락 소유자 선점 실험 (mode: lhp, 옵션: --oversubscription=1,2,4,8 의 최대 배수)
+ * 스레드 수를 CPU 수의 1, 2, 4, 8배로 늘려 소유자가 선점되는 상황을 만든다.
+ */
+void run_lhp_benchmark() {
+    int num_cpus = max(1u, thread::hardware_concurrency());
+    int max_factor = option_value("oversubscription", 8);
+
+    cout << "===== Lock-Holder Preemption Evaluation =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+    cout << "CPUs: " << num_cpus << endl;
+
+    for (int factor = 1; factor <= max_factor; factor *= 2) {
+        int num_threads = num_cpus * factor;
+        cout << "\n--- Testing with " << num_threads << " Threads (" << factor << "x oversubscribed) ---" << endl;
+
+        run_experiment<TAS_Lock>("TAS Lock", num_threads);
+        run_experiment<LHP_Lock<LHP_Policy::Spin>>("LHP Lock (detect only)", num_threads);
+        report_lhp_stats();
+        run_experiment<LHP_Lock<LHP_Policy::Yield>>("LHP Lock (yield)", num_threads);
+        report_lhp_stats();
+        run_experiment<LHP_Lock<LHP_Policy::Park>>("LHP Lock (park)", num_threads);
+        report_lhp_stats();
+    }
+}
+
+/**
+ * @brief GCR 실험 (mode: gcr, 옵션: --gcr-limit=N 활성 스레드 상한 (기본 2), --oversubscription=8)
+ * CPU 수의 배수로 스레드를 늘려 가며 스핀 락과 GCR로 감싼 스핀 락을 비교한다.
+ */
+void run_gcr_benchmark() {
+    int num_cpus = max(1u, thread::hardware_concurrency());
+    int max_factor = option_value("oversubscription", 8);
+    g_gcr_active_limit = option_value("gcr-limit", option_value("active", GCR_DEFAULT_ACTIVE_LIMIT));
+
+    cout << "===== Generic Concurrency Restriction Evaluation =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+    cout << "CPUs: " << num_cpus << ", Active Limit: " << max(1, g_gcr_active_limit) << endl;
+
+    for (int factor = 1; factor <= max_factor; factor *= 2) {
+        int num_threads = num_cpus * factor;
+        cout << "\n--- Testing with " << num_threads << " Threads (" << factor << "x oversubscribed) ---" << endl;
+
+        run_experiment<TAS_Lock>("TAS Lock", num_threads);
+        run_experiment<GCR_Lock<TAS_Lock>>("GCR TAS Lock", num_threads);
+        report_gcr_stats();
+        run_experiment<TTAS_Lock>("TTAS Lock", num_threads);
+        run_experiment<GCR_Lock<TTAS_Lock>>("GCR TTAS Lock", num_threads);
+        report_gcr_stats();
+        run_experiment<Backoff_Lock>("Backoff Lock", num_threads);
+        run_experiment<GCR_Lock<Backoff_Lock>>("GCR Backoff Lock", num_threads);
+        report_gcr_stats();
+    }
+}
+
+/**
+ * @brief 혼합 우선순위 실험 (mode: priority, 옵션: --rt=1 이면 높은 우선순위 스레드에 SCHED_FIFO 시도)
+ * 낮은 우선순위 스레드는 nice 10으로 실행되며, 높은 우선순위 스레드의 락 획득 지연을 비교한다.
+ */
+void run_priority_benchmark() {
+    bool use_rt = option_value("rt", 0) != 0;
+
+    cout << "===== Mixed-Priority Lock Acquisition Latency =====" << endl;
+    cout << "Operations per Thread: " << PRIORITY_OPERATIONS_PER_THREAD << ", High Priority: every 4th thread ("
+         << (use_rt ? "SCHED_FIFO" : "nice 0 vs 10") << ")" << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_priority_experiment<TAS_Lock>("TAS Lock", num_threads, use_rt);
+        run_priority_experiment<Hybrid_Lock>("Hybrid Lock", num_threads, use_rt);
+        run_priority_experiment<PI_Lock>("PI Lock", num_threads, use_rt);
+    }
+}
+
+/**
+ * @brief 다수 객체 실험 (mode: objects, 옵션: --objects=N 으로 객체 수 고정, --skew=0.99 Zipf 지수)
+ * 객체 수를 10^3 ~ 10^7로 늘려 락 상태가 캐시에 들어가지 않을 때의 성능을 비교한다.
+ */
+void run_object_benchmark() {
+    vector<int> counts = object_counts;
+    if (g_options.count("objects")) {
+        counts = {max(1, int(option_value("objects", 1)))};
+    }
+    double skew = g_options.count("skew") ? stod(g_options["skew"]) : 0.0;
+    if (skew == 1.0) {
+        skew = 0.999; // Zipf 생성기는 theta = 1을 지원하지 않는다
+    }
+
+    cout << "===== Lock-per-Object Performance Evaluation =====" << endl;
+    cout << "Operations: " << OBJECT_OPERATIONS << ", Skew (Zipf theta): " << skew << endl;
+    cout << "sizeof: TAS Lock = " << sizeof(TAS_Lock) << " B, TTAS Lock = " << sizeof(TTAS_Lock)
+         << " B, Hybrid Lock = " << sizeof(Hybrid_Lock) << " B, std::mutex = " << sizeof(std::mutex)
+         << " B, Parking Lot Lock = " << sizeof(Parking_Lot_Lock) << " B" << endl;
+
+    for (int num_objects : counts) {
+        cout << "\n===== " << num_objects << " Objects =====" << endl;
+        Zipf_Generator zipf(num_objects, skew);
+
+        for (int num_threads : thread_counts) {
+            cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+            run_object_experiment<TAS_Lock>("TAS Lock", num_threads, num_objects, zipf);
+            run_object_experiment<TTAS_Lock>("TTAS Lock", num_threads, num_objects, zipf);
+            run_object_experiment<Hybrid_Lock>("Hybrid Lock", num_threads, num_objects, zipf);
+            run_object_experiment<std::mutex>("std::mutex", num_threads, num_objects, zipf);
+            run_object_experiment<Parking_Lot_Lock>("Parking Lot Lock", num_threads, num_objects, zipf);
+        }
+    }
+}
+
+/**
+ * @brief 배리어 실험 (mode: barrier)
+ * 스핀 대기와 futex 대기 변형을 스레드 수별로 비교한다.
+ */
+void run_barrier_benchmark() {
+    cout << "===== Barrier Performance Evaluation =====" << endl;
+    cout << "Episodes: " << BARRIER_EPISODES << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_barrier_experiment<Central_Barrier<Barrier_Wait::Spin>>("Central Barrier (spin)", num_threads);
+        run_barrier_experiment<Central_Barrier<Barrier_Wait::Park>>("Central Barrier (futex)", num_threads);
+        run_barrier_experiment<Combining_Tree_Barrier<Barrier_Wait::Spin>>("Combining Tree Barrier (spin)", num_threads);
+        run_barrier_experiment<Combining_Tree_Barrier<Barrier_Wait::Park>>("Combining Tree Barrier (futex)", num_threads);
+        run_barrier_experiment<Dissemination_Barrier<Barrier_Wait::Spin>>("Dissemination Barrier (spin)", num_threads);
+        run_barrier_experiment<Dissemination_Barrier<Barrier_Wait::Park>>("Dissemination Barrier (futex)", num_threads);
+        run_barrier_experiment<Tournament_Barrier<Barrier_Wait::Spin>>("Tournament Barrier (spin)", num_threads);
+        run_barrier_experiment<Tournament_Barrier<Barrier_Wait::Park>>("Tournament Barrier (futex)", num_threads);
+        run_barrier_experiment<Std_Barrier>("std::barrier", num_threads);
+    }
+}
+
+/**
+ * @brief 알림 지연 실험 (mode: notify)
+ * 두 스레드가 차례를 주고받으며 이벤트 카운트와 condition_variable의 알림-깨어남 지연을 비교한다.
+ */
+void run_notify_benchmark() {
+    // 고정은 이 프로세스에 허용된 CPU 안에서만 의미가 있다 (taskset/cgroup 제한)
+    vector<int> allowed = allowed_cpus();
+    if (allowed.empty()) {
+        allowed.push_back(0);
+    }
+
+    cout << "===== Notify-to-Wake Latency Evaluation =====" << endl;
+    cout << "Handoffs: " << NOTIFY_HANDOFFS << ", Allowed CPUs: " << allowed.size() << endl;
+
+    string cross_name = "Pinned, Cross CPU";
+    if (allowed.size() >= 2) {
+        cross_name = "Pinned, CPU " + to_string(allowed[0]) + " <-> CPU " + to_string(allowed[1]);
+    }
+    const pair<Thread_Placement, string> placements[] = {
+        {Thread_Placement::Unpinned, "Unpinned"},
+        {Thread_Placement::Same_CPU, "Pinned, Same CPU (CPU " + to_string(allowed[0]) + ")"},
+        {Thread_Placement::Cross_CPU, cross_name},
+    };
+    for (const auto& [placement, placement_name] : placements) {
+        cout << "\n--- " << placement_name << " ---" << endl;
+        if (placement == Thread_Placement::Cross_CPU && allowed.size() < 2) {
+            cout << "Skipped (needs at least 2 allowed CPUs)" << endl;
+            continue;
+        }
+
+        run_notify_experiment<Event_Count_Channel>("Event Count", placement, allowed);
+        run_notify_experiment<Condvar_Channel>("std::condition_variable", placement, allowed);
+    }
+}
+
+/**
+ * @brief 파이버 실험 (mode: fibers, 옵션: --fibers=N 으로 파이버 수 고정, --workers=CPU 수)
+ * 수천 개의 파이버와 같은 수의 OS 스레드가 공유 카운터를 두고 경합할 때를 비교한다.
+ */
+void run_fiber_benchmark() {
+    vector<int> counts = fiber_counts;
+    if (g_options.count("fibers")) {
+        counts = {max(1, int(option_value("fibers", 1)))};
+    }
+    int num_workers = max(1, int(option_value("workers", max(1u, thread::hardware_concurrency()))));
+
+    cout << "===== User-Level Fiber Evaluation =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+    cout << "Workers: " << num_workers << ", Yield Interval: " << FIBER_YIELD_INTERVAL << endl;
+
+    for (int num_fibers : counts) {
+        cout << "\n--- Testing with " << num_fibers << " Fibers / Threads ---" << endl;
+
+        run_fiber_experiment(num_fibers, num_workers);
+        run_experiment<TTAS_Lock>("TTAS Lock (OS threads)", num_fibers);
+        run_experiment<Hybrid_Lock>("Hybrid Lock (OS threads)", num_fibers);
+    }
+}
+
+/**
+ * @brief 메모리 회수 실험 (mode: reclaim)
+ * Michael-Scott 큐와 Treiber 스택에 Hazard Pointers / EBR / 회수 안 함을 붙여 비교한다.
+ */
+void run_reclaim_benchmark() {
+    cout << "===== Safe Memory Reclamation Evaluation =====" << endl;
+    cout << "Operations: " << RECLAIM_OPERATIONS << " (push 50%, pop 50%)" << endl;
+    cout << "Node Allocator: " << (g_use_node_pool ? "per-thread slab pool" : "system") << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        run_reclaim_experiment<MS_Queue, No_Reclamation>("MS Queue + No Reclamation", num_threads);
+        run_reclaim_experiment<MS_Queue, Hazard_Pointers>("MS Queue + Hazard Pointers", num_threads);
+        run_reclaim_experiment<MS_Queue, Epoch_Reclamation>("MS Queue + EBR", num_threads);
+        run_reclaim_experiment<Treiber_Stack, No_Reclamation>("Treiber Stack + No Reclamation", num_threads);
+        run_reclaim_experiment<Treiber_Stack, Hazard_Pointers>("Treiber Stack + Hazard Pointers", num_threads);
+        run_reclaim_experiment<Treiber_Stack, Epoch_Reclamation>("Treiber Stack + EBR", num_threads);
+    }
+}
+
+/**
+ * @brief 확장성 모델 실험 (mode: scaling, 옵션: --predict=128 예측할 스레드 수)
+ * 스레드 1개부터 스윕한 공유 카운터 처리량으로 락마다 Amdahl / USL을 적합한다.
+ */
+void run_scaling_benchmark() {
+    int predict_threads = option_value("predict", 128);
+    vector<int> sweep = {1};
+    sweep.insert(sweep.end(), thread_counts.begin(), thread_counts.end());
+
+    cout << "===== Scalability Model Fitting =====" << endl;
+    cout << "Target Operation: Summing integers from " << START_NUM << " to " << END_NUM << endl;
+
+    vector<pair<int, double>> tas, ttas, backoff;
+    for (int num_threads : sweep) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        tas.emplace_back(num_threads, NUM_OPERATIONS / run_experiment<TAS_Lock>("TAS Lock", num_threads));
+        ttas.emplace_back(num_threads, NUM_OPERATIONS / run_experiment<TTAS_Lock>("TTAS Lock", num_threads));
+        backoff.emplace_back(num_threads, NUM_OPERATIONS / run_experiment<Backoff_Lock>("Backoff Lock", num_threads));
+    }
+
+    cout << "\n===== Fitted Models =====" << endl;
+    report_scalability("TAS Lock", tas, predict_threads);
+    report_scalability("TTAS Lock", ttas, predict_threads);
+    report_scalability("Backoff Lock", backoff, predict_threads);
+}
+
+
+/**
+ * @brief 코어 간 전송 지연 실험 (mode: c2c, 옵션: --cpus=N 측정할 CPU 수, --pin=0,2,4 락 실험 배치)
+ * 모든 CPU 쌍의 캐시 라인 핑퐁 지연 행렬을 재고, 고정된 스레드로 돌린 락 결과에 기대 인계 비용을 붙인다.
+ */
+void run_c2c_benchmark() {
+    int num_cpus = max(1u, thread::hardware_concurrency());
+    num_cpus = max(1, int(min<long long>(num_cpus, option_value("cpus", num_cpus))));
+    if (g_pinned_cpus.empty()) {
+        // 기본 배치: 이 프로세스가 쓸 수 있는 CPU 중 측정한 범위 안의 것
+        for (int cpu : allowed_cpus()) {
+            if (cpu < num_cpus) {
+                g_pinned_cpus.push_back(cpu);
+            }
+        }
+    }
+
+    cout << "===== Core-to-Core Cache Line Latency =====" << endl;
+    cout << "CPUs: " << num_cpus << ", Round Trips: " << C2C_ROUND_TRIPS << " x " << C2C_BATCHES << " batches (median)" << endl;
+    vector<vector<double>> matrix = measure_c2c_matrix(num_cpus);
+    print_c2c_matrix(matrix);
+
+    cout << "\nLock Pinning: CPUs";
+    for (int cpu : g_pinned_cpus) {
+        cout << " " << cpu;
+    }
+    cout << " (thread i -> CPU[i % " << g_pinned_cpus.size() << "])" << endl;
+
+    for (int num_threads : thread_counts) {
+        cout << "\n--- Testing with " << num_threads << " Threads ---" << endl;
+
+        report_expected_handoff(matrix, num_threads, run_experiment<TTAS_Lock>("TTAS Lock", num_threads));
+        report_expected_handoff(matrix, num_threads, run_experiment<Ticket_Lock>("Ticket Lock", num_threads));
+        report_expected_handoff(matrix, num_threads, run_experiment<MCS_Lock>("MCS Lock", num_threads));
+    }
+}
+
+
+// =================================================
+
+int main(int argc, char* argv[]) {
+    string mode = parse_options(argc, argv);
+    print_timer_info();
+    // --allocator=system 이면 워크로드 노드도 시스템 할당자로 (기본: 스레드별 슬랩 풀)
+    g_use_node_pool = !(g_options.count("allocator") && g_options["allocator"] == "system");
+    // --pin=0,2,4 이면 run_experiment의 스레드를 나열한 CPU에 차례로 고정
+    if (g_options.count("pin")) {
+        g_pinned_cpus = parse_cpu_list(g_options["pin"]);
+        vector<int> allowed = allowed_cpus();
+        for (int cpu : g_pinned_cpus) {
+            if (find(allowed.begin(), allowed.end(), cpu) == allowed.end()) {
+                cerr << "Invalid --pin CPU: " << cpu << " (not in this process's CPU affinity mask)" << endl;
+                return 1;
+            }
+        }
+    }
+
+    if (mode == "counter") {
+        run_counter_benchmark();
+    } else if (mode == "stack") {
+        run_stack_benchmark();
+    } else if (mode == "set") {
+        run_set_benchmark();
+    } else if (mode == "bank") {
+        run_bank_benchmark();
+    } else if (mode == "stm") {
+        run_stm_benchmark();
+    } else if (mode == "read") {
+        run_read_mostly_benchmark();
+    } else if (mode == "async") {
+        run_async_benchmark();
+    } else if (mode == "lhp") {
+        run_lhp_benchmark();
+    } else if (mode == "gcr") {
+        run_gcr_benchmark();
+    } else if (mode == "priority") {
+        run_priority_benchmark();
+    } else if (mode == "objects") {
+        run_object_benchmark();
+    } else if (mode == "barrier") {
+        run_barrier_benchmark();
+    } else if (mode == "notify") {
+        run_notify_benchmark();
+    } else if (mode == "fibers") {
+        run_fiber_benchmark();
+    } else if (mode == "reclaim") {
+        run_reclaim_benchmark();
+    } else if (mode == "scaling") {
+        run_scaling_benchmark();
+    } else if (mode == "c2c") {
+        run_c2c_benchmark();
+    } else {
+        cerr << "Unknown mode: " << mode << endl;
+        cerr << "Usage: " << argv[0] << " [counter|stack|set|bank|stm|read|async|lhp|gcr|priority|objects|barrier|notify|fibers|reclaim|scaling|c2c] [--key=value ...]" << endl;
+        return 1;
     }
 
     return 0;